@@ -0,0 +1,57 @@
+#pragma once
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// linear allocator for scratch data of one frame (strings, rect lists), everything is freed at once by Reset
+// memory that did not fit is taken from heap and buffer grows to it on Reset, so after warm-up frames do not allocate
+class FrameArena
+{
+public:
+    explicit FrameArena(size_t capacity = 4096)
+        : buffer_(capacity)
+    {
+    }
+
+    void* Allocate(size_t size, size_t alignment)
+    {
+        auto offset = (used_ + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= buffer_.size())
+        {
+            used_ = offset + size;
+            return buffer_.data() + offset;
+        }
+
+        overflow_.emplace_back(new std::max_align_t[(size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]);
+        overflowSize_ += size + alignment;
+        return overflow_.back().get();
+    }
+
+    template <typename T>
+    T* AllocateArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "arena does not run destructors");
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // frees everything allocated since last reset
+    void Reset()
+    {
+        if (!overflow_.empty())
+        {
+            buffer_.resize(buffer_.size() + overflowSize_);
+            overflow_.clear();
+            overflowSize_ = 0;
+        }
+
+        used_ = 0;
+    }
+
+    size_t GetCapacity() const noexcept { return buffer_.size(); }
+    size_t GetUsed() const noexcept { return used_; }
+
+private:
+    std::vector<uint8_t> buffer_;
+    size_t used_{};
+
+    std::vector<std::unique_ptr<std::max_align_t[]>> overflow_;
+    size_t overflowSize_{};
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <bitset>
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+inline size_t CountTrailingZeros(uint64_t value) noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return index;
+#elif defined(_MSC_VER)
+    unsigned long index = 0;
+    if (_BitScanForward(&index, static_cast<unsigned long>(value)))
+        return index;
+    _BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+    return index + 32;
+#else
+    return size_t(__builtin_ctzll(value));
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// fixed size set of bits, iteration over set bits goes by bit scans in ascending order
+class Bitmask
+{
+public:
+    using TWord = uint64_t;
+    static constexpr size_t c_WordBits = 64;
+
+    void Assign(size_t size, bool value)
+    {
+        size_ = size;
+        words_.assign((size + c_WordBits - 1) / c_WordBits, value ? ~TWord(0) : TWord(0));
+
+        // keep bits after size cleared
+        const auto tail = size % c_WordBits;
+        if (value && 0 != tail)
+            words_.back() = (TWord(1) << tail) - 1;
+    }
+
+    size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+    bool Test(size_t index) const noexcept
+    {
+        return 0 != (words_[index / c_WordBits] & (TWord(1) << (index % c_WordBits)));
+    }
+
+    void Set(size_t index) noexcept
+    {
+        words_[index / c_WordBits] |= (TWord(1) << (index % c_WordBits));
+    }
+
+    void Reset(size_t index) noexcept
+    {
+        words_[index / c_WordBits] &= ~(TWord(1) << (index % c_WordBits));
+    }
+
+    template <typename TFunc>
+    void ForEach(TFunc&& func) const
+    {
+        for (size_t i = 0; i < words_.size(); ++i)
+        {
+            for (auto word = words_[i]; 0 != word; word &= word - 1)
+                func(i * c_WordBits + CountTrailingZeros(word));
+        }
+    }
+
+    const std::vector<TWord>& GetWords() const noexcept
+    {
+        return words_;
+    }
+
+    // bytes of words as GetWords gave them, may be unaligned, false when bits after size are set
+    bool CheckWords(const void* bytes) const noexcept
+    {
+        if (words_.empty())
+            return true;
+
+        TWord last = 0;
+        std::memcpy(&last, static_cast<const uint8_t*>(bytes) + (words_.size() - 1) * sizeof(TWord), sizeof(TWord));
+        const auto tail = size_ % c_WordBits;
+        return 0 == tail || 0 == (last >> tail);
+    }
+
+    // set bits of bytes of words as GetWords gave them, may be unaligned
+    size_t CountWords(const void* bytes) const noexcept
+    {
+        size_t res = 0;
+        for (size_t i = 0; i < words_.size(); ++i)
+        {
+            TWord word = 0;
+            std::memcpy(&word, static_cast<const uint8_t*>(bytes) + i * sizeof(TWord), sizeof(TWord));
+            res += std::bitset<c_WordBits>(word).count();
+        }
+        return res;
+    }
+
+    // size of bitmask stays, false and bitmask unchanged when words do not pass CheckWords
+    bool AssignWords(const void* bytes) noexcept
+    {
+        if (!CheckWords(bytes))
+            return false;
+
+        if (!words_.empty())
+            std::memcpy(words_.data(), bytes, words_.size() * sizeof(TWord));
+        return true;
+    }
+
+    // set bits
+    size_t Count() const noexcept
+    {
+        size_t res = 0;
+        for (auto word : words_)
+            res += std::bitset<c_WordBits>(word).count();
+        return res;
+    }
+
+private:
+    std::vector<TWord> words_;
+    size_t size_{};
+};
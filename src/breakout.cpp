@@ -20,13 +20,16 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     ULONG_PTR           gdiplusToken;
     Gdiplus::GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, NULL);
 
-    std::srand(GetTickCount());
+    // 1 ms timer resolution, so game loop sleeps until next tick or frame precisely
+    timeBeginPeriod(1);
 
     if (mainWnd.Init(hInstance, nCmdShow))
     {
         ret = mainWnd.Run();
     }
 
+    timeEndPeriod(1);
+
     Gdiplus::GdiplusShutdown(gdiplusToken);
 
     return ret;
@@ -1,46 +1,38 @@
 #pragma once
 
 #include "resource.h"
-#include "elements.h"
-
-// test mode - ball moves with max speed and ricochet from playground bottom
-// useful to verify that game can be won
-constexpr bool c_TestMode = false;
-
-struct GameSettings
-{
-    size_t livesStart = 3;
-    float gameInformationHeight = 60.f; // pixels    
-    std::set <size_t> hitsForSpeedUp{ 4, 12 };
-    std::set <size_t> linesForSpeedUp{ 4, 6 };
-
-    float playerHeight = 10.f; // pixels
-    size_t playerStartPosition = 5;
-    size_t playerPositionsCount = 10;
-    size_t playerSplitOnHitTop = 2;
-
-    float ballRadius = 7.f; // pixels
-    float ballSpeedUpKoeff = 1.2f;
-    float ballSpeedBase = c_TestMode ? 0.5f : 0.005f; // relative to rect
-    PointF ballStartDirection{ 0.5f, 1.0f }; // x and y of vector (negative is up/left)
-    PointF ballStartPosition{ 0.5f, 0.5f }; // relative to rect, center
-
-    Targets::TLines targetLines = {
-        {0,{Color::Yellow,1}},
-        {1,{Color::Yellow,1}},
-        {2,{Color::Green,3}},
-        {3,{Color::Green,3}},
-        {4,{Color::Orange,5}},
-        {5,{Color::Orange,5}},
-        {6,{Color::Red,7}},
-        {7,{Color::Red,7}}
-    };
-
-    size_t targetsInLine = 13;
-    float targetsMargin = 5.f; // pixels
-    float targetsTopMargin = 30.f; // pixels
-    float targetHeight = 10.f; // pixels
-};
+#include "simulation.h"
+#include "painter.h"
+#include "gdirenderer.h"
+#include "softrenderer.h"
+#include "damage.h"
+#include "layer.h"
+#include "triplebuffer.h"
+#include "gameloop.h"
+#include "inputqueue.h"
+#include "latency.h"
+#include "profiler.h"
+#include "tracer.h"
+#include "replay.h"
+#include "rewind.h"
+
+// false - frames are drawn by software renderer and copied to window, true - by GDI+
+constexpr bool c_GdiPlusRendering = false;
+
+constexpr wchar_t c_WindowTitle[] = L"Breakout Game";
+
+// input to display latency histograms are written there on exit
+constexpr char c_LatencyFile[] = "latency.txt";
+
+// profiler samples are exported there by C
+constexpr char c_ProfileFile[] = "profile.csv";
+
+// trace is written there when T stops tracing, unless path is given by environment variable, which also starts tracing
+constexpr char c_TraceFile[] = "trace.json";
+constexpr char c_TraceVariable[] = "BREAKOUT_TRACE";
+
+// session is recorded for replay into file named by this environment variable
+constexpr char c_RecordVariable[] = "BREAKOUT_RECORD";
 
 class GameMainWindow
 {
@@ -50,7 +42,7 @@ public:
     {
         RegisterMainWindowClass(L"BREAKOUT", hInstance);
 
-        hWnd_ = CreateWindowW(L"BREAKOUT", L"Breakout Game", WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_THICKFRAME,
+        hWnd_ = CreateWindowW(L"BREAKOUT", c_WindowTitle, WS_OVERLAPPED | WS_CAPTION | WS_SYSMENU | WS_THICKFRAME,
             0, 0, 500, 600, nullptr, nullptr, hInstance, this);
 
         if (!hWnd_)
@@ -74,9 +66,24 @@ public:
 
     int Run()
     {
-        CreateGameElements();
+        char tracePath[MAX_PATH] = {};
+        if (0 != GetEnvironmentVariableA(c_TraceVariable, tracePath, MAX_PATH) && 0 != tracePath[0])
+        {
+            tracePath_ = tracePath;
+            g_Tracer.Start();
+        }
+        g_Tracer.SetThreadName("window");
 
-        gameInfo_->SetPaused(false);
+        {
+            auto lock = Lock();
+            simulation_.NewGame();
+            tickTime_ = TLoopClock::now();
+            PublishFrame();
+
+            char recordPath[MAX_PATH] = {};
+            if (0 != GetEnvironmentVariableA(c_RecordVariable, recordPath, MAX_PATH) && 0 != recordPath[0])
+                recorder_.Start(recordPath, simulation_.GetSettings().seed, simulation_.GetWorld());
+        }
 
         running_.store(true);
         workingThread_ = std::thread(&GameMainWindow::ProcessGameLogicAsync, this);
@@ -90,8 +97,23 @@ public:
         }
 
         running_.store(false);
+        wake_.Notify();
         workingThread_.join();
 
+        if (g_Tracer.IsEnabled())
+            ToggleTracing();
+
+        if (recorder_.IsRecording())
+            recorder_.Stop(simulation_);
+
+        if (0 != latency_.GetStage(InputLatency::total).GetCount())
+            latency_.Dump(c_LatencyFile);
+
+        // GDI+ objects go before GDI+ shutdown
+        gdiPlusRenderer_.Release();
+        bitmapGraphics_.reset();
+        bitmap_.reset();
+
         return (int)msg.wParam;
     }
 
@@ -123,11 +145,24 @@ private:
         {
         case WM_PAINT:
         {
-            std::lock_guard<std::mutex> lock{ lock_ };
+            // no lock - painting uses only latest published frame
+            TraceScope trace("paint");
             PAINTSTRUCT ps;
             HDC hdc = BeginPaint(hWnd_, &ps);
-            Paint(hdc);
+            Paint(hdc, ps.rcPaint);
             EndPaint(hWnd_, &ps);
+            UpdateFrameStats();
+        }
+        break;
+
+        case WM_SIZE:
+        {
+            TraceScope trace("resize");
+            auto lock = Lock();
+            simulation_.Resize(RectF(0.f, 0.f, REAL(LOWORD(lParam)), REAL(HIWORD(lParam))));
+            recorder_.Resize(simulation_.GetTick(), simulation_.GetWorld());
+            PublishFrame();
+            wake_.Notify();
         }
         break;
 
@@ -145,50 +180,62 @@ private:
         return 0;
     }
 
+    // input is only queued, logic thread applies it at start of next tick, so key press never waits for tick or paint
     void ProcessUserInput(WPARAM wParam)
     {
-        bool bCanRedraw = false;
-        {
-            std::lock_guard<std::mutex> lock{ lock_ };
+        TraceScope trace("input");
+        GameInputs inputs;
 
-            switch (wParam)
-            {
-            case VK_LEFT:
-                if (!gameInfo_->IsPaused())
-                {
-                    player_->MoveLeft();
-                    bCanRedraw = true;
-                }
-                break;
-            case VK_RIGHT:
-                if (!gameInfo_->IsPaused())
-                {
-                    player_->MoveRight();
-                    bCanRedraw = true;
-                }
-                break;
-            case VK_SPACE:
-                if (!gameInfo_->IsOver())
-                {
-                    gameInfo_->SetPaused(!gameInfo_->IsPaused());
-                    bCanRedraw = true;
-                }
-                break;
-            case VK_RETURN:
-                CreateGameElements();
-                gameInfo_->SetPaused(false);
-                bCanRedraw = true;
-                break;
-            case VK_ESCAPE:
-                DestroyWindow(hWnd_);
-                break;
-            default:
-                break;
-            }
+        switch (wParam)
+        {
+        case VK_LEFT:
+            inputs.playerMoves = -1;
+            break;
+        case VK_RIGHT:
+            inputs.playerMoves = 1;
+            break;
+        case VK_SPACE:
+            inputs.togglePause = true;
+            break;
+        case VK_RETURN:
+            inputs.newGame = true;
+            break;
+        case VK_BACK:
+            inputs.rewind = true;
+            break;
+        case VK_ESCAPE:
+            DestroyWindow(hWnd_);
+            return;
+        case 'L':
+            showLatency_ = !showLatency_;
+            ShowLatency();
+            return;
+        case 'P':
+            g_Profiler.SetEnabled(!g_Profiler.IsEnabled());
+            ShowProfile();
+            return;
+        case 'C':
+            g_Profiler.ExportCsv(c_ProfileFile);
+            return;
+        case 'T':
+            ToggleTracing();
+            return;
+        default:
+            return;
         }
 
-        if (bCanRedraw)
-            RedrawWindow(hWnd_, NULL, NULL, RDW_INVALIDATE | RDW_UPDATENOW | RDW_NOCHILDREN);
+        inputs_.Push(inputs, TLoopClock::now());
+        wake_.Notify();
+    }
+
+    // software frames present only their damage, so window is not invalidated, paint is just posted
+    // GDI+ frames are drawn whole into invalidated window
+    void RequestFrame()
+    {
+        if (c_GdiPlusRendering)
+            InvalidateRect(hWnd_, NULL, FALSE);
+        else
+            RedrawWindow(hWnd_, NULL, NULL, RDW_INTERNALPAINT);
     }
 
     ATOM RegisterMainWindowClass(LPCWSTR className, HINSTANCE hInst)
@@ -212,196 +259,311 @@ private:
         return RegisterClassExW(&wcex);
     }
 
-    void Paint(HDC hdc)
+    // invalid is part of window invalidated by system, e.g. uncovered or resized, it is empty for requested frames
+    void Paint(HDC hdc, const RECT& invalid)
     {
+        const auto paintStart = TLoopClock::now();
+        const auto& frame = frames_.GetFront();
+
         RECT rect;
         ::GetClientRect(hWnd_, &rect);
 
         const auto width = rect.right - rect.left;
         const auto height = rect.bottom - rect.top;
 
-        // prepare memory context
-        Bitmap bitmap(width, height, PixelFormat32bppARGB);
-        Graphics bGraphics(&bitmap);
+        if (c_GdiPlusRendering)
+            PaintGdiPlus(hdc, frame, width, height);
+        else
+            PaintSoftware(hdc, frame, width, height, invalid);
 
-        const RectF rectF(0.f, 0.f, REAL(width), REAL(height));
+        if (running_.load())
+            latency_.Add(frame.input, paintStart, TLoopClock::now());
+    }
 
-        DrawGameElements(&bGraphics, &rectF);
+    void PaintGdiPlus(HDC hdc, const FrameSnapshot& frame, int width, int height)
+    {
+        // memory context is kept until window size changes
+        if (!bitmap_ || bitmap_->GetWidth() != UINT(width) || bitmap_->GetHeight() != UINT(height))
+        {
+            bitmapGraphics_.reset();
+            bitmap_ = std::make_unique<Bitmap>(width, height, PixelFormat32bppARGB);
+            bitmapGraphics_ = std::make_unique<Graphics>(bitmap_.get());
+        }
+
+        if (running_.load())
+        {
+            gdiPlusRenderer_.Begin(bitmapGraphics_.get());
+            painter_.Draw(&gdiPlusRenderer_, frame, TLoopClock::now(), arena_);
+            arena_.Reset();
+        }
 
         // draw from memory to paint context
+        ProfileScope profile(eProfilePhase::present);
         Graphics graphics(hdc);
-        graphics.DrawImage(&bitmap, 0.f, 0.f);
+        graphics.DrawImage(bitmap_.get(), 0.f, 0.f);
     }
 
-    void DrawGameElements(Graphics* graphics, const RectF* rect)
+    void PaintSoftware(HDC hdc, const FrameSnapshot& frame, int width, int height, const RECT& invalid)
     {
-        if (!running_.load())
+        if (0 == width || 0 == height)
             return;
 
-        playground_->Draw(graphics, rect);
-        gameInfo_->Draw(graphics, rect);
+        auto& framebuffer = framebuffers_.Acquire(width, height);
 
-        auto playgroundRect = playground_->GetBounds();
+        if (running_.load())
+        {
+            // only what differs from frame left in framebuffer or shown in window is redrawn, from target layer and moving part of frame
+            const auto now = TLoopClock::now();
+            const auto& damage = damage_.Track(framebuffers_.GetCurrent(), width, height, frame, now);
+            layer_.Update(painter_, frame, width, height);
+
+            SoftwareRenderer renderer(framebuffer);
+            for (const auto& rect : damage.GetRects())
+                layer_.Draw(renderer, painter_, frame, now, arena_, rect);
+            arena_.Reset();
+
+            // paint context is clipped to invalid part of window, damage goes through window context
+            if (!damage.IsEmpty())
+            {
+                HDC windowDC = GetDC(hWnd_);
+                for (const auto& rect : damage.GetRects())
+                    Present(windowDC, framebuffer, int(rect.GetLeft()), int(rect.GetTop()), int(rect.GetRight()), int(rect.GetBottom()));
+                ReleaseDC(hWnd_, windowDC);
+            }
+        }
 
-        player_->Draw(graphics, playgroundRect);
-        ball_->Draw(graphics, playgroundRect);
-        targets_->Draw(graphics, playgroundRect);
+        if (!IsRectEmpty(&invalid))
+            Present(hdc, framebuffer, invalid.left, invalid.top, invalid.right, invalid.bottom);
     }
 
-    void ProcessGameLogicAsync()
+    // copies part of framebuffer to same place of window
+    static void Present(HDC hdc, Framebuffer& framebuffer, int left, int top, int right, int bottom)
     {
-        while (running_.load())
-        {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ProfileScope profile(eProfilePhase::present);
 
-            if (!IsWindow(hWnd_))
-                continue;
-
-            RedrawWindow(hWnd_, NULL, NULL, RDW_INVALIDATE | RDW_UPDATENOW | RDW_NOCHILDREN);
+        left = std::max(left, 0);
+        top = std::max(top, 0);
+        right = std::min(right, framebuffer.GetWidth());
+        bottom = std::min(bottom, framebuffer.GetHeight());
+        if (left >= right || top >= bottom)
+            return;
 
-            ProcessGameLogic();
-        }
+        // rows of part are passed as top-down DIB of their own, framebuffer has same pixel layout as 32 bpp DIB
+        // source is then whole height of DIB, so its y origin does not depend on DIB orientation
+        BITMAPINFO bmi = {};
+        bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        bmi.bmiHeader.biWidth = framebuffer.GetWidth();
+        bmi.bmiHeader.biHeight = -(bottom - top);
+        bmi.bmiHeader.biPlanes = 1;
+        bmi.bmiHeader.biBitCount = 32;
+        bmi.bmiHeader.biCompression = BI_RGB;
+
+        SetDIBitsToDevice(hdc, left, top, DWORD(right - left), DWORD(bottom - top), left, 0, 0, UINT(bottom - top),
+            framebuffer.GetRow(top), &bmi, DIB_RGB_COLORS);
     }
 
-    void CreateGameElements()
+    // called with lock_ held, so logic and window threads never publish at same time
+    void PublishFrame()
     {
-        playground_ = std::make_unique< Playgroud>(
-            Color::Black,
-            settings_.gameInformationHeight);
-
-        gameInfo_ = std::make_unique< GameInformation>(
-            Color::DarkBlue,
-            settings_.gameInformationHeight,
-            settings_.livesStart);
-
-        player_ = std::make_unique<Player>(
-            Color::White,
-            settings_.playerHeight,
-            settings_.playerStartPosition,
-            settings_.playerPositionsCount);
-
-        ball_ = std::make_unique<Ball>(
-            Color::White,
-            settings_.ballRadius,
-            settings_.ballSpeedBase,
-            settings_.ballStartDirection,
-            settings_.ballStartPosition,
-            settings_.targetHeight + settings_.ballRadius * 1.5f);
-
-        targets_ = std::make_unique<Targets>(
-            settings_.targetLines,
-            settings_.targetsInLine,
-            settings_.targetsMargin,
-            settings_.targetsTopMargin,
-            settings_.targetHeight);
+        auto& frame = frames_.GetBack();
+        simulation_.Capture(frame);
+        frame.tickTime = tickTime_;
+        frame.tickDuration = tickDuration_;
+        stamper_.Stamp(frame, TLoopClock::now());
+        frames_.Publish();
     }
 
-    void ProcessGameLogic()
+    // interval between paints, reported once a second to debugger output
+    void UpdateFrameStats()
     {
-        std::lock_guard<std::mutex> lock{ lock_ };
+        const auto now = TLoopClock::now();
+        if (TLoopClock::time_point() != lastPaint_)
+            frameStats_.Add(ToMicroseconds(now - lastPaint_));
+        lastPaint_ = now;
 
-        if (gameInfo_->IsOver())
-            return;
-
-        if (gameInfo_->IsPaused())
-            return;
-
-        if (targets_->IsEmpty())
+        if (now - lastFrameReport_ >= std::chrono::seconds(1))
         {
-            gameInfo_->SetPaused(true);
-            gameInfo_->SetVictory();
-            return;
-        }
+            OutputDebugStringA((frameStats_.Format("frame") + "\n").c_str());
+            frameStats_.Reset();
+            lastFrameReport_ = now;
 
-        ProcessBallHits();
+            if (showLatency_)
+            {
+                OutputDebugStringA(latency_.Format().c_str());
+                ShowLatency();
+            }
 
-        if (!gameInfo_->IsOver())
-            ball_->CalcNextPosition();
+            if (g_Profiler.IsEnabled())
+                ShowProfile();
+        }
     }
 
-    void ProcessBallHits()
+    // window title shows total input to display latency while it is toggled on by L
+    void ShowLatency()
     {
-        if (ball_->HitWithTop(player_.get(), Ball::eHitType::hitOutside)
-            || ball_->HitWithBottom(player_.get(), Ball::eHitType::hitOutside))
+        if (!showLatency_)
         {
+            SetWindowTextW(hWnd_, c_WindowTitle);
             return;
         }
 
-        if (ball_->HitWithBottom(playground_.get(), Ball::eHitType::hitInside))
-        {
-            if (c_TestMode)
-                return;
+        const auto title = "Breakout Game - input to display " + latency_.GetStage(InputLatency::total).Format("latency");
+        SetWindowTextA(hWnd_, title.c_str());
+    }
 
-            gameInfo_->RemoveLife();
+    // mean and max time of phases in last second replace HUD text while profiler is on
+    void ShowProfile()
+    {
+        if (g_Profiler.IsEnabled())
+            painter_.SetOverlay(g_Profiler.Format(TLoopClock::now(), std::chrono::seconds(1), 3));
+        else
+            painter_.SetOverlay({});
 
-            if (gameInfo_->NoMoreLives())
-            {
-                ball_->SetColor(Color::Red);
-                gameInfo_->SetPaused(true);
-                gameInfo_->SetFail();
-            }
-        }
+        // information area is not in damage of frame otherwise
+        damage_.Invalidate();
+        RequestFrame();
+    }
 
-        if (ball_->HitWithTop(playground_.get(), Ball::eHitType::hitInside))
+    // started tracing is stopped and written to file, otherwise tracing starts
+    void ToggleTracing()
+    {
+        if (!g_Tracer.IsEnabled())
         {
-            if (!gameInfo_->IsHitTop())
-            {
-                gameInfo_->SetHitTop();
-                player_->SplitBy(settings_.playerSplitOnHitTop);
-            }
+            g_Tracer.Start();
+            return;
         }
 
-        {
-            auto target = targets_->GetTargetHitWithBall(ball_.get());
-            if (nullptr != target)
-            {
-                ProcessHitTarget(target);
-                targets_->RemoveTarget(target);
-                //if (c_TestMode)
-                //    gameInfo_->SetPaused(true);
-
-                return;
-            }
-        }
+        g_Tracer.Stop();
+        g_Tracer.Write(tracePath_.empty() ? c_TraceFile : tracePath_.c_str());
+    }
 
-        ball_->HitWithLeft(playground_.get(), Ball::eHitType::hitInside);
-        ball_->HitWithRight(playground_.get(), Ball::eHitType::hitInside);
+    // games differ on each start of window, seed of game in play is GameSimulation::GetSeed
+    static GameSettings GetWindowSettings()
+    {
+        std::random_device device;
+        GameSettings settings;
+        settings.seed = (uint64_t(device()) << 32u) | device();
+        return settings;
     }
 
-    void ProcessHitTarget(const Target* target)
+    // lock_ with wait for it and time it is held traced
+    TraceLockGuard<std::mutex> Lock()
     {
-        gameInfo_->AddToScore(target->GetCost());
+        return TraceLockGuard<std::mutex>(lock_, "wait lock_", "hold lock_");
+    }
 
-        gameInfo_->IncrementHits();
+    void ProcessGameLogicAsync()
+    {
+        g_Tracer.SetThreadName("logic");
 
-        const auto hits = gameInfo_->GetHits();
+        const auto& settings = simulation_.GetSettings();
+        GameLoop loop(settings.ticksPerSecond, settings.framesPerSecond, settings.maxTicksPerUpdate);
 
-        const auto line = target->GetLine();
+        {
+            auto lock = Lock();
+            tickDuration_ = loop.GetTimestep().GetTickDuration();
+        }
 
-        const auto newHitLine = !gameInfo_->IsHitLine(line);
-        if (newHitLine)
-            gameInfo_->SetHitLine(line);
+        loop.Run(running_, wake_,
+            [this]()
+            {
+                auto lock = Lock();
+                return simulation_.IsIdle();
+            },
+            [this, &settings](TLoopClock::time_point tickTime)
+            {
+                TraceScope trace("tick");
+                auto lock = Lock();
+
+                const auto tick = simulation_.GetTick();
+                if (recorder_.IsKeyframeDue(tick))
+                    recorder_.Keyframe(simulation_);
+
+                TLoopClock::time_point received;
+                size_t applied = 0;
+                bool rewind = false;
+                inputs_.Apply(simulation_, tickTime, [this, tick, &received, &applied, &rewind](const InputEvent& event)
+                    {
+                        if (0 == applied++)
+                            received = event.time;
+                        rewind = rewind || event.inputs.rewind;
+                        rewind_.Input(event.inputs);
+                        recorder_.Record(tick, event.inputs);
+                    });
+
+                // back by one second of game per key press, after other inputs of tick
+                if (rewind && rewind_.Rewind(uint64_t(settings.ticksPerSecond), simulation_) && recorder_.IsRecording())
+                {
+                    simulation_.SaveState(rewindState_);
+                    recorder_.State(tick, rewindState_);
+                }
 
-        const bool speedUpBall = (settings_.hitsForSpeedUp.count(hits) > 0) || (newHitLine && settings_.linesForSpeedUp.count(line) > 0);
+                if (0 != applied)
+                    stamper_.Applied(received, TLoopClock::now());
 
-        if (speedUpBall)
-        {
-            ball_->SpeedUp(settings_.ballSpeedUpKoeff);
-        }
+                simulation_.Step(GameInputs());
+                rewind_.Update(simulation_);
+            },
+            [this](TLoopClock::time_point tickTime)
+            {
+                TraceScope trace("publish");
+                auto lock = Lock();
+                tickTime_ = tickTime;
+                PublishFrame();
+            },
+            [this]()
+            {
+                // paint happens later on window thread, logic thread does not wait for it
+                if (IsWindow(hWnd_))
+                    RequestFrame();
+            },
+            [&loop]()
+            {
+                char dropped[64] = {};
+                std::snprintf(dropped, sizeof(dropped), ", dropped ticks: %llu\n", (unsigned long long)loop.GetTimestep().GetDroppedTicks());
+                OutputDebugStringA((loop.GetTickStats().Format("tick") + dropped).c_str());
+            });
     }
 
 private:
-    GameSettings settings_;
-
     HWND hWnd_ = nullptr;
 
-    std::unique_ptr<Playgroud> playground_;
-    std::unique_ptr<GameInformation> gameInfo_;
-    std::unique_ptr<Player> player_;
-    std::unique_ptr<Ball> ball_;
-    std::unique_ptr<Targets> targets_;
+    GameSimulation simulation_{ GetWindowSettings() };
+    TripleBuffer<FrameSnapshot> frames_;
+    FramePainter painter_;
+
+    // window thread only, memory is reused between frames
+    GdiPlusRenderer gdiPlusRenderer_;
+    std::unique_ptr<Bitmap> bitmap_;
+    std::unique_ptr<Graphics> bitmapGraphics_;
+    FramebufferPool<2> framebuffers_;
+    DamageTracker<2> damage_;
+    TargetLayer layer_;
+    FrameArena arena_;
+
+    // guarded by lock_
+    TLoopClock::time_point tickTime_;
+    TLoopClock::duration tickDuration_{};
+    InputStamper stamper_;
+    ReplayRecorder recorder_; // window thread records resize with lock_ held
+
+    // logic thread only
+    RewindBuffer rewind_{ simulation_.GetSettings().rewindSeconds, simulation_.GetSettings().ticksPerSecond,
+        simulation_.GetSettings().rewindInterval };
+    std::vector<uint8_t> rewindState_; // of rewind, for recording
+
+    // window thread only
+    IntervalStats frameStats_;
+    TLoopClock::time_point lastPaint_;
+    TLoopClock::time_point lastFrameReport_;
+    InputLatency latency_;
+    bool showLatency_{};
 
     std::thread workingThread_;
     std::atomic_bool running_ = false;
+    WakeEvent wake_; // logic thread sleeps on it while game is idle
+    InputQueue inputs_; // window thread to logic thread
     std::mutex lock_;
-};
\ No newline at end of file
+
+    std::string tracePath_; // from environment
+};
\ No newline at end of file
@@ -0,0 +1,389 @@
+#pragma once
+
+// batched test of ball bounds against many target rects
+// gives same result as calling Ball::HitWithTarget for each rect in order, but tests 8 (SSE2) or 16 (AVX2) rects per loop
+// spans shorter than batch go to scalar tail, so behind grid of Targets (few cells per line) game is effectively scalar,
+// wide loops pay off on whole lines as in bench-collide
+
+#include "bitmask.h"
+#include "simd.h"
+
+#include <limits>
+
+enum class eHitFace : uint8_t
+{
+    none,
+    left,
+    right,
+    top,
+    bottom,
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// target rects as separate arrays of edges
+struct TargetRects
+{
+    void Resize(size_t count)
+    {
+        left.resize(count);
+        top.resize(count);
+        right.resize(count);
+        bottom.resize(count);
+    }
+
+    void Set(size_t index, const RectF& rect) noexcept
+    {
+        left[index] = rect.GetLeft();
+        top[index] = rect.GetTop();
+        right[index] = rect.GetRight();
+        bottom[index] = rect.GetBottom();
+    }
+
+    RectF Get(size_t index) const noexcept
+    {
+        return RectF(left[index], top[index], right[index] - left[index], bottom[index] - top[index]);
+    }
+
+    std::vector<float> left;
+    std::vector<float> top;
+    std::vector<float> right;
+    std::vector<float> bottom;
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// one face test: ball overlaps rect along cross axis and crosses face edge
+// same comparisons as RectF::IntersectsWith of ball bounds and zero sized edge rect
+struct FaceTest
+{
+    FaceTest(const TargetRects& rects, const RectF& ball, eHitFace face) noexcept
+    {
+        const bool horizontalEdge = (eHitFace::top == face || eHitFace::bottom == face);
+
+        if (horizontalEdge)
+        {
+            edge = (eHitFace::top == face) ? rects.top.data() : rects.bottom.data();
+            crossLo = rects.left.data();
+            crossHi = rects.right.data();
+            ballMin = ball.GetTop();
+            ballMax = ball.GetBottom();
+            ballCrossMin = ball.GetLeft();
+            ballCrossMax = ball.GetRight();
+        }
+        else
+        {
+            edge = (eHitFace::left == face) ? rects.left.data() : rects.right.data();
+            crossLo = rects.top.data();
+            crossHi = rects.bottom.data();
+            ballMin = ball.GetLeft();
+            ballMax = ball.GetRight();
+            ballCrossMin = ball.GetTop();
+            ballCrossMax = ball.GetBottom();
+        }
+    }
+
+    bool Test(size_t i) const noexcept
+    {
+        return ballCrossMin < crossHi[i] && ballCrossMax > crossLo[i] && ballMin < edge[i] && ballMax > edge[i];
+    }
+
+    const float* edge{};
+    const float* crossLo{};
+    const float* crossHi{};
+    float ballMin{};
+    float ballMax{};
+    float ballCrossMin{};
+    float ballCrossMax{};
+};
+
+// bits [index, index + count) of alive mask, count <= 32
+inline uint32_t GetAliveBits(const Bitmask& alive, size_t index, size_t count) noexcept
+{
+    const auto& words = alive.GetWords();
+    const auto word = index / Bitmask::c_WordBits;
+    const auto shift = index % Bitmask::c_WordBits;
+
+    auto bits = words[word] >> shift;
+    if (shift + count > Bitmask::c_WordBits)
+        bits |= words[word + 1] << (Bitmask::c_WordBits - shift);
+
+    return uint32_t(bits & ((uint64_t(1) << count) - 1));
+}
+
+// first alive rect in [begin, end) hit by ball with one of faces (first face has priority), c_NoHit if none
+// face receives which face was hit
+using TFindFirstHit = size_t(*)(const TargetRects& rects, const Bitmask& alive, size_t begin, size_t end,
+    const RectF& ball, eHitFace first, eHitFace second, eHitFace& face);
+
+constexpr size_t c_NoHit = size_t(-1);
+
+inline size_t FindFirstHitScalar(const TargetRects& rects, const Bitmask& alive, size_t begin, size_t end,
+    const RectF& ball, eHitFace first, eHitFace second, eHitFace& face)
+{
+    if (eHitFace::none == first)
+        return c_NoHit;
+
+    const FaceTest firstTest(rects, ball, first);
+    const FaceTest secondTest(rects, ball, second);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (!alive.Test(i))
+            continue;
+
+        if (firstTest.Test(i))
+        {
+            face = first;
+            return i;
+        }
+
+        if (secondTest.Test(i))
+        {
+            face = second;
+            return i;
+        }
+    }
+
+    return c_NoHit;
+}
+
+#ifdef BREAKOUT_X86
+
+BREAKOUT_TARGET_SSE2 inline uint32_t FaceMaskSse2(const FaceTest& test, size_t i) noexcept
+{
+    const __m128 edge = _mm_loadu_ps(test.edge + i);
+
+    __m128 res = _mm_cmplt_ps(_mm_set1_ps(test.ballCrossMin), _mm_loadu_ps(test.crossHi + i));
+    res = _mm_and_ps(res, _mm_cmpgt_ps(_mm_set1_ps(test.ballCrossMax), _mm_loadu_ps(test.crossLo + i)));
+    res = _mm_and_ps(res, _mm_cmplt_ps(_mm_set1_ps(test.ballMin), edge));
+    res = _mm_and_ps(res, _mm_cmpgt_ps(_mm_set1_ps(test.ballMax), edge));
+
+    return uint32_t(_mm_movemask_ps(res));
+}
+
+BREAKOUT_TARGET_SSE2 inline size_t FindFirstHitSse2(const TargetRects& rects, const Bitmask& alive, size_t begin, size_t end,
+    const RectF& ball, eHitFace first, eHitFace second, eHitFace& face)
+{
+    if (eHitFace::none == first)
+        return c_NoHit;
+
+    const FaceTest firstTest(rects, ball, first);
+    const FaceTest secondTest(rects, ball, second);
+
+    constexpr size_t c_Batch = 8;
+
+    size_t i = begin;
+    for (; i + c_Batch <= end; i += c_Batch)
+    {
+        const auto aliveBits = GetAliveBits(alive, i, c_Batch);
+        if (0 == aliveBits)
+            continue;
+
+        const auto firstBits = (FaceMaskSse2(firstTest, i) | (FaceMaskSse2(firstTest, i + 4) << 4)) & aliveBits;
+        const auto secondBits = (FaceMaskSse2(secondTest, i) | (FaceMaskSse2(secondTest, i + 4) << 4)) & aliveBits;
+
+        const auto hitBits = firstBits | secondBits;
+        if (0 != hitBits)
+        {
+            const auto index = CountTrailingZeros(hitBits);
+            face = (0 != (firstBits & (1u << index))) ? first : second;
+            return i + index;
+        }
+    }
+
+    return FindFirstHitScalar(rects, alive, i, end, ball, first, second, face);
+}
+
+BREAKOUT_TARGET_AVX2 inline uint32_t FaceMaskAvx2(const FaceTest& test, size_t i) noexcept
+{
+    const __m256 edge = _mm256_loadu_ps(test.edge + i);
+
+    __m256 res = _mm256_cmp_ps(_mm256_set1_ps(test.ballCrossMin), _mm256_loadu_ps(test.crossHi + i), _CMP_LT_OQ);
+    res = _mm256_and_ps(res, _mm256_cmp_ps(_mm256_set1_ps(test.ballCrossMax), _mm256_loadu_ps(test.crossLo + i), _CMP_GT_OQ));
+    res = _mm256_and_ps(res, _mm256_cmp_ps(_mm256_set1_ps(test.ballMin), edge, _CMP_LT_OQ));
+    res = _mm256_and_ps(res, _mm256_cmp_ps(_mm256_set1_ps(test.ballMax), edge, _CMP_GT_OQ));
+
+    return uint32_t(_mm256_movemask_ps(res));
+}
+
+BREAKOUT_TARGET_AVX2 inline size_t FindFirstHitAvx2(const TargetRects& rects, const Bitmask& alive, size_t begin, size_t end,
+    const RectF& ball, eHitFace first, eHitFace second, eHitFace& face)
+{
+    if (eHitFace::none == first)
+        return c_NoHit;
+
+    const FaceTest firstTest(rects, ball, first);
+    const FaceTest secondTest(rects, ball, second);
+
+    constexpr size_t c_Batch = 16;
+
+    size_t i = begin;
+    for (; i + c_Batch <= end; i += c_Batch)
+    {
+        const auto aliveBits = GetAliveBits(alive, i, c_Batch);
+        if (0 == aliveBits)
+            continue;
+
+        const auto firstBits = (FaceMaskAvx2(firstTest, i) | (FaceMaskAvx2(firstTest, i + 8) << 8)) & aliveBits;
+        const auto secondBits = (FaceMaskAvx2(secondTest, i) | (FaceMaskAvx2(secondTest, i + 8) << 8)) & aliveBits;
+
+        const auto hitBits = firstBits | secondBits;
+        if (0 != hitBits)
+        {
+            const auto index = CountTrailingZeros(hitBits);
+            face = (0 != (firstBits & (1u << index))) ? first : second;
+            return i + index;
+        }
+    }
+
+    return FindFirstHitSse2(rects, alive, i, end, ball, first, second, face);
+}
+
+#endif // BREAKOUT_X86
+
+inline TFindFirstHit GetFindFirstHit(eSimdLevel level) noexcept
+{
+#ifdef BREAKOUT_X86
+    switch (level)
+    {
+    case eSimdLevel::avx2:
+        return FindFirstHitAvx2;
+    case eSimdLevel::sse2:
+        return FindFirstHitSse2;
+    default:
+        break;
+    }
+#else
+    (void)level;
+#endif
+    return FindFirstHitScalar;
+}
+
+// best kernel for current CPU, chosen once
+inline TFindFirstHit GetFindFirstHit() noexcept
+{
+    static const auto func = GetFindFirstHit(GetSupportedSimdLevel());
+    return func;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// swept tests, ball bounds move by movement, time is part of movement (0 - start, 1 - end)
+
+// entry and exit time of moving interval [min0, max0] into [min1, max1] along one axis
+inline bool SweepAxis(float min0, float max0, float min1, float max1, float velocity, float& entry, float& exit) noexcept
+{
+    if (velocity > 0.f)
+    {
+        entry = (min1 - max0) / velocity;
+        exit = (max1 - min0) / velocity;
+    }
+    else if (velocity < 0.f)
+    {
+        entry = (max1 - min0) / velocity;
+        exit = (min1 - max0) / velocity;
+    }
+    else
+    {
+        if (max0 <= min1 || min0 >= max1)
+            return false;
+
+        entry = -std::numeric_limits<float>::infinity();
+        exit = std::numeric_limits<float>::infinity();
+    }
+    return true;
+}
+
+// first contact of ball with rect from outside within [0, maxTime]
+// rects ball already overlaps are skipped, they are resolved by static hit tests
+inline bool SweepOutside(const RectF& ball, const PointF& movement, float left, float top, float right, float bottom,
+    float maxTime, float& time, eHitFace& face) noexcept
+{
+    const bool overlaps = ball.GetLeft() < right && ball.GetRight() > left && ball.GetTop() < bottom && ball.GetBottom() > top;
+    if (overlaps)
+        return false;
+
+    float entryX = 0.f, exitX = 0.f, entryY = 0.f, exitY = 0.f;
+    if (!SweepAxis(ball.GetLeft(), ball.GetRight(), left, right, movement.X, entryX, exitX)
+        || !SweepAxis(ball.GetTop(), ball.GetBottom(), top, bottom, movement.Y, entryY, exitY))
+    {
+        return false;
+    }
+
+    const auto entry = std::max(entryX, entryY);
+    const auto exit = std::min(exitX, exitY);
+
+    // touching corner or edge without overlap is not a contact
+    if (entry < 0.f || entry > maxTime || entry >= exit)
+        return false;
+
+    time = entry;
+
+    // same time on both axes - vertical face wins, like in Ball::HitWithTarget
+    if (entryX > entryY)
+        face = movement.X > 0.f ? eHitFace::left : eHitFace::right;
+    else
+        face = movement.Y > 0.f ? eHitFace::top : eHitFace::bottom;
+
+    return true;
+}
+
+inline bool SweepOutside(const RectF& ball, const PointF& movement, const RectF& rect, float maxTime, float& time, eHitFace& face) noexcept
+{
+    return SweepOutside(ball, movement, rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom(), maxTime, time, face);
+}
+
+// first contact of ball with walls of bounds from inside within [0, maxTime], face is wall reached
+// ball already behind wall and moving out of bounds hits it at once
+inline bool SweepInside(const RectF& ball, const PointF& movement, const RectF& bounds, float maxTime, float& time, eHitFace& face) noexcept
+{
+    bool res = false;
+
+    const auto test = [&](float distance, float velocity, eHitFace wall)
+    {
+        const auto t = std::max(distance / velocity, 0.f);
+        if (t <= maxTime && (!res || t < time))
+        {
+            time = t;
+            face = wall;
+            res = true;
+        }
+    };
+
+    // Y-axis walls (top and bottom) first, so they win on same time
+    if (movement.Y > 0.f)
+        test(bounds.GetBottom() - ball.GetBottom(), movement.Y, eHitFace::bottom);
+    else if (movement.Y < 0.f)
+        test(bounds.GetTop() - ball.GetTop(), movement.Y, eHitFace::top);
+
+    if (movement.X > 0.f)
+        test(bounds.GetRight() - ball.GetRight(), movement.X, eHitFace::right);
+    else if (movement.X < 0.f)
+        test(bounds.GetLeft() - ball.GetLeft(), movement.X, eHitFace::left);
+
+    return res;
+}
+
+// earliest contact with alive rect in [begin, end) within [0, maxTime], lower index wins on same time
+inline size_t FindFirstContact(const TargetRects& rects, const Bitmask& alive, size_t begin, size_t end,
+    const RectF& ball, const PointF& movement, float maxTime, float& time, eHitFace& face) noexcept
+{
+    size_t res = c_NoHit;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        if (!alive.Test(i))
+            continue;
+
+        float t = 0.f;
+        eHitFace f = eHitFace::none;
+        if (SweepOutside(ball, movement, rects.left[i], rects.top[i], rects.right[i], rects.bottom[i], maxTime, t, f)
+            && (c_NoHit == res || t < time))
+        {
+            res = i;
+            time = t;
+            face = f;
+            maxTime = t;
+        }
+    }
+
+    return res;
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+// damage tracking: only pixels which differ between frame left in framebuffer and frame to draw are redrawn and presented
+// damage is found by comparing snapshots, window thread may skip published frames, so it cannot rely on changes of one tick
+
+#include "frame.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// pixel aligned rects to redraw, overlapping rects are merged, too many of them collapse into their bounds
+class DamageRegion
+{
+public:
+    static constexpr size_t c_MaxRects = 16;
+
+    DamageRegion()
+    {
+        rects_.reserve(c_MaxRects + 1);
+    }
+
+    // empty region of framebuffer of size
+    void Reset(int width, int height)
+    {
+        bounds_ = RectF(0.f, 0.f, float(width), float(height));
+        rects_.clear();
+    }
+
+    void AddAll()
+    {
+        rects_.clear();
+        if (!bounds_.IsEmptyArea())
+            rects_.push_back(bounds_);
+    }
+
+    // rect is grown to whole pixels and one more pixel around for antialiased edges
+    void Add(const RectF& rect)
+    {
+        const auto left = std::floor(rect.GetLeft()) - 1.f;
+        const auto top = std::floor(rect.GetTop()) - 1.f;
+        RectF pixels(left, top, std::ceil(rect.GetRight()) + 1.f - left, std::ceil(rect.GetBottom()) + 1.f - top);
+        if (!RectF::Intersect(pixels, pixels, bounds_))
+            return;
+
+        // merged rect may overlap rects checked before, so start over after each merge
+        for (size_t i = 0; i < rects_.size();)
+        {
+            if (rects_[i].IntersectsWith(pixels))
+            {
+                RectF::Union(pixels, pixels, rects_[i]);
+                rects_[i] = rects_.back();
+                rects_.pop_back();
+                i = 0;
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        rects_.push_back(pixels);
+
+        if (rects_.size() > c_MaxRects)
+        {
+            for (size_t i = 1; i < rects_.size(); ++i)
+                RectF::Union(rects_[0], rects_[0], rects_[i]);
+            rects_.resize(1);
+        }
+    }
+
+    bool IsEmpty() const noexcept
+    {
+        return rects_.empty();
+    }
+
+    const std::vector<RectF>& GetRects() const noexcept
+    {
+        return rects_;
+    }
+
+    // pixels to redraw, rects do not overlap
+    size_t GetArea() const noexcept
+    {
+        size_t res = 0;
+        for (const auto& rect : rects_)
+            res += size_t(rect.Width) * size_t(rect.Height);
+        return res;
+    }
+
+private:
+    RectF bounds_;
+    std::vector<RectF> rects_;
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// remembers frame drawn into each of Count framebuffers used in turn (see FramebufferPool)
+// and tells what has to be redrawn in one of them and presented to show next frame
+// framebuffer holds frame drawn Count frames before, but window shows frame presented last,
+// so damage is union of changes from both of them
+template <size_t Count>
+class DamageTracker
+{
+public:
+    // damage of framebuffer at index for frame painted at now, frame is taken as drawn into it and presented afterwards
+    const DamageRegion& Track(size_t index, int width, int height, const FrameSnapshot& frame, std::chrono::steady_clock::time_point now)
+    {
+        auto& drawn = drawn_[index];
+        const auto ball = frame.GetBallBounds(now);
+
+        region_.Reset(width, height);
+
+        if (!AddChanges(drawn, width, height, frame, ball))
+            region_.AddAll();
+        else if (presented_ != index && !AddChanges(drawn_[presented_], width, height, frame, ball))
+            region_.AddAll();
+
+        // targets keep capacity, so copy does not allocate once it is big enough
+        drawn.frame = frame;
+        drawn.frame.ball.rect = ball;
+        drawn.width = width;
+        drawn.height = height;
+        drawn.valid = true;
+        presented_ = index;
+
+        return region_;
+    }
+
+    // next frame is drawn whole into every framebuffer
+    void Invalidate() noexcept
+    {
+        for (auto& drawn : drawn_)
+            drawn.valid = false;
+    }
+
+private:
+    struct DrawnFrame
+    {
+        FrameSnapshot frame; // ball holds interpolated bounds it was drawn with
+        int width{};
+        int height{};
+        bool valid{};
+    };
+
+    // adds what differs between drawn frame and frame with ball at bounds, false if whole frame has to be redrawn
+    bool AddChanges(const DrawnFrame& drawn, int width, int height, const FrameSnapshot& frame, const RectF& ball)
+    {
+        if (!drawn.valid
+            || drawn.width != width
+            || drawn.height != height
+            || !IsSame(drawn.frame.playground, frame.playground)
+            || !drawn.frame.info.rect.Equals(frame.info.rect)
+            || drawn.frame.info.color.GetValue() != frame.info.color.GetValue()
+            || !ForEachRemovedTarget(drawn.frame.targets, frame.targets, [this](const ShapeSnapshot& target) { region_.Add(target.rect); }))
+        {
+            return false;
+        }
+
+        if (!IsSame(drawn.frame.player, frame.player))
+        {
+            region_.Add(drawn.frame.player.rect);
+            region_.Add(frame.player.rect);
+        }
+
+        if (!drawn.frame.ball.rect.Equals(ball) || drawn.frame.ball.color.GetValue() != frame.ball.color.GetValue())
+        {
+            region_.Add(drawn.frame.ball.rect);
+            region_.Add(ball);
+        }
+
+        if (IsInfoChanged(drawn.frame.info, frame.info))
+            region_.Add(frame.info.rect);
+
+        return true;
+    }
+
+    static bool IsSame(const ShapeSnapshot& a, const ShapeSnapshot& b) noexcept
+    {
+        return a.rect.Equals(b.rect) && a.color.GetValue() == b.color.GetValue();
+    }
+
+    static bool IsInfoChanged(const InfoSnapshot& a, const InfoSnapshot& b) noexcept
+    {
+        return a.score != b.score
+            || a.lives != b.lives
+            || a.paused != b.paused
+            || a.victory != b.victory
+            || a.fail != b.fail;
+    }
+
+    std::array<DrawnFrame, Count> drawn_;
+    size_t presented_{}; // index of framebuffer with frame shown in window
+    DamageRegion region_;
+};
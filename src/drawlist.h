@@ -0,0 +1,88 @@
+#pragma once
+
+// alive targets grouped by color, each group goes to renderer as one fill command
+// there are few colors (one per target line at most), so frame costs O(colors) commands instead of O(targets)
+
+#include "frame.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// groups are kept between frames, group is rebuilt only when its targets change, all of them after layout change or new game
+// frame with version of targets list was updated to is skipped, so frames between hits cost nothing
+// groups are never removed, so their arrays keep capacity
+class TargetDrawList
+{
+public:
+    struct Batch
+    {
+        Color color;
+        std::vector<RectF> rects;
+        bool dirty{};
+    };
+
+    // brings groups to alive targets of frame, version 0 is unknown and always compared
+    void Update(const std::vector<ShapeSnapshot>& targets, uint64_t version = 0)
+    {
+        if (0 != version && version == version_)
+            return;
+
+        const bool rebuild = !ForEachRemovedTarget(targets_, targets,
+            [this](const ShapeSnapshot& target) { GetBatch(target.color).dirty = true; });
+
+        bool dirty = rebuild;
+        for (auto& batch : batches_)
+        {
+            batch.dirty = batch.dirty || rebuild;
+            dirty = dirty || batch.dirty;
+            if (batch.dirty)
+                batch.rects.clear();
+        }
+
+        if (dirty)
+        {
+            for (const auto& target : targets)
+            {
+                auto& batch = GetBatch(target.color);
+                if (batch.dirty)
+                    batch.rects.push_back(target.rect);
+            }
+
+            for (auto& batch : batches_)
+                batch.dirty = false;
+
+            ++rebuilds_;
+        }
+
+        // keeps capacity, so copy does not allocate once it is big enough
+        targets_ = targets;
+        version_ = version;
+    }
+
+    const std::vector<Batch>& GetBatches() const noexcept
+    {
+        return batches_;
+    }
+
+    // how many times any group was rebuilt
+    size_t GetRebuilds() const noexcept
+    {
+        return rebuilds_;
+    }
+
+private:
+    Batch& GetBatch(const Color& color)
+    {
+        for (auto& batch : batches_)
+        {
+            if (batch.color.GetValue() == color.GetValue())
+                return batch;
+        }
+
+        batches_.push_back(Batch{ color, {}, true });
+        return batches_.back();
+    }
+
+    std::vector<ShapeSnapshot> targets_; // targets in groups
+    uint64_t version_{}; // of targets
+    std::vector<Batch> batches_;
+    size_t rebuilds_{};
+};
@@ -1,15 +1,17 @@
 #pragma once
 
-constexpr LPCWSTR c_strPaused = L"Paused";
-constexpr LPCWSTR c_strScore = L"Score: ";
-constexpr LPCWSTR c_strWin = L"Congratulations - You won the game!";
-constexpr LPCWSTR c_strFail = L"You failed the game!";
-constexpr LPCWSTR c_strControls = L"Space - Pause, Enter - New game, Esc - Quit";
-constexpr LPCWSTR c_strLives = L"Lives left:";
-
-struct IDrawable
+#include "bitmask.h"
+#include "collision.h"
+#include "frame.h"
+#include "profiler.h"
+#include "random.h"
+#include "state.h"
+
+#include <cassert>
+
+struct ILayoutable
 {
-    virtual void Draw(Graphics* graphics, const RectF* rect) = 0;
+    virtual void Layout(const RectF* rect) = 0;
 };
 
 struct IHasBounds
@@ -23,9 +25,9 @@ struct IColorable
 };
 
 class VisualElement
-    : public IDrawable
-    , public IHasBounds
+    : public IHasBounds
     , public IColorable
+    , public ILayoutable
 {
 public:
     const RectF* GetBounds() const noexcept override final
@@ -37,6 +39,12 @@ public:
         color_ = color;
     }
 
+    void Capture(ShapeSnapshot& shape) const noexcept
+    {
+        shape.rect = rect_;
+        shape.color = color_;
+    }
+
     RectF rect_;
     Color color_;
 };
@@ -52,14 +60,12 @@ public:
         SetColor(color);
     }
 
-    void Draw(Graphics* graphics, const RectF* rect) override final
+    void Layout(const RectF* rect) override final
     {
         rect_ = *rect;
         rect_.Height -= infoBoardHeight_;
-
-        const SolidBrush sb(color_);
-        graphics->FillRectangle(&sb, rect_);
     }
+
 private:
     float infoBoardHeight_{};
 };
@@ -69,27 +75,33 @@ class GameInformation
     : public VisualElement
 {
 public:
-    GameInformation(const Color& color, float height, size_t livesStart)
-        : height_(height)
+    // lines is count of target lines, lines hit are kept as bits, score max is score of all targets hit
+    GameInformation(const Color& color, float height, size_t livesStart, size_t lines, size_t scoreMax)
+        : livesStart_(livesStart)
+        , scoreMax_(scoreMax)
         , lives_(livesStart)
+        , height_(height)
     {
         SetColor(color);
+        linesHits_.Assign(lines, false);
     }
 
-    void Draw(Graphics* graphics, const RectF* rect) override final
+    void Layout(const RectF* rect) override final
     {
         rect_ = *rect;
         rect_.Y += (rect_.Height - height_);
+        rect_.Height = height_;
+    }
 
-        const SolidBrush sb(color_);
-        graphics->FillRectangle(&sb, rect_);
-
-        DrawPause(graphics);
-        DrawScore(graphics);
-        DrawVictory(graphics);
-        DrawFail(graphics);
-        DrawControls(graphics);
-        DrawLives(graphics);
+    void Capture(InfoSnapshot& info) const noexcept
+    {
+        info.rect = rect_;
+        info.color = color_;
+        info.score = score_;
+        info.lives = lives_;
+        info.paused = paused_;
+        info.victory = IsVictory();
+        info.fail = IsFail();
     }
 
     void SetPaused(bool paused) noexcept
@@ -132,6 +144,16 @@ public:
         score_ += score;
     }
 
+    size_t GetScore() const noexcept
+    {
+        return score_;
+    }
+
+    size_t GetLives() const noexcept
+    {
+        return lives_;
+    }
+
     bool IsHitTop() const noexcept
     {
         return hittop_;
@@ -154,12 +176,13 @@ public:
 
     void SetHitLine(size_t line) noexcept
     {
-        linesHits_.insert(line);
+        if (line < linesHits_.Size())
+            linesHits_.Set(line);
     }
 
-    bool IsHitLine(size_t line) const
+    bool IsHitLine(size_t line) const noexcept
     {
-        return 0 != linesHits_.count(line);
+        return line < linesHits_.Size() && linesHits_.Test(line);
     }
 
     bool NoMoreLives() const noexcept
@@ -173,126 +196,75 @@ public:
             --lives_;
     }
 
-private:
-    enum class eState
-    {
-        undefined,
-        victory,
-        fail,
-    };
-
-    void DrawPause(Graphics* graphics)
-    {
-        if (!IsPaused())
-            return;
-
-        const StringFormat sf;
-        const SolidBrush brush(Color::Yellow);
-        const Gdiplus::Font font(L"Arial", 14.f, FontStyleRegular, UnitPixel);
-
-        const PointF pt(rect_.X + 5, rect_.Y + 5);
-        RectF strRect;
-        graphics->MeasureString(c_strPaused, -1, &font, pt, &strRect);
-
-        graphics->DrawString(c_strPaused, -1, &font, strRect, &sf, &brush);
-    }
-
-    void DrawScore(Graphics* graphics)
-    {
-        const StringFormat sf;
-        const SolidBrush brush(Color::Yellow);
-        const Gdiplus::Font font(L"Arial", 14.f, FontStyleRegular, UnitPixel);
-
-        const std::wstring str = c_strScore + std::to_wstring(score_);
-
-        const PointF pt(rect_.X + rect_.Width / 3.f, rect_.Y + 5.f);
-        RectF strRect;
-        graphics->MeasureString(str.c_str(), -1, &font, pt, &strRect);
-
-        graphics->DrawString(str.c_str(), -1, &font, strRect, &sf, &brush);
-    }
-
-    void DrawVictory(Graphics* graphics)
-    {
-        if (!IsVictory())
-            return;
-
-        DrawResult(graphics, c_strWin, Color::Green);
-    }
-
-    void DrawFail(Graphics* graphics)
-    {
-        if (!IsFail())
-            return;
-
-        DrawResult(graphics, c_strFail, Color::Red);
-    }
+    // lives, paused, state, score, hit top, hits, then words of lines hit
+    static constexpr size_t c_StateSize = 8 + 1 + 1 + 8 + 1 + 8;
 
-    void DrawResult(Graphics* graphics, LPCWSTR result, const Color& color)
+    size_t GetStateSize() const noexcept
     {
-        const StringFormat sf;
-        const SolidBrush brush(color);
-        const Gdiplus::Font font(L"Arial", 14.f, FontStyleRegular, UnitPixel);
-
-        const PointF pt(rect_.X + 5.f, rect_.Y + 25.f);
-        RectF strRect;
-        graphics->MeasureString(result, -1, &font, pt, &strRect);
-
-        graphics->DrawString(result, -1, &font, strRect, &sf, &brush);
+        return c_StateSize + linesHits_.GetWords().size() * sizeof(Bitmask::TWord);
     }
 
-    void DrawControls(Graphics* graphics)
+    void SaveState(StateWriter& writer) const
     {
-        const StringFormat sf;
-        const SolidBrush brush(Color::White);
-        const Gdiplus::Font font(L"Arial", 12.f, FontStyleRegular, UnitPixel);
-
-        const PointF pt(rect_.X + 5, rect_.Y + 45.f);
-        RectF strRect;
-        graphics->MeasureString(c_strControls, -1, &font, pt, &strRect);
-
-        graphics->DrawString(c_strControls, -1, &font, strRect, &sf, &brush);
+        writer.Add(uint64_t(lives_));
+        writer.Add(uint8_t(paused_));
+        writer.Add(uint8_t(state_));
+        writer.Add(uint64_t(score_));
+        writer.Add(uint8_t(hittop_));
+        writer.Add(uint64_t(hits_));
+        const auto& words = linesHits_.GetWords();
+        writer.AddBytes(words.data(), words.size() * sizeof(Bitmask::TWord));
     }
 
-    void DrawLives(Graphics* graphics)
+    // values out of their range are refused, element is then left as it was, lives and score are bounded by those of game
+    // with apply false state is only read and checked
+    bool LoadState(StateReader& reader, bool apply = true)
     {
-        const StringFormat sf;
-        const SolidBrush brush(Color::Yellow);
-        const Gdiplus::Font font(L"Arial", 14.f, FontStyleRegular, UnitPixel);
+        uint64_t lives = 0;
+        bool paused = false;
+        uint8_t state = 0;
+        uint64_t score = 0;
+        bool hittop = false;
+        uint64_t hits = 0;
+        if (!reader.Get(lives) || !reader.GetBool(paused) || !reader.Get(state) || state > uint8_t(eState::fail)
+            || !reader.Get(score) || !reader.GetBool(hittop) || !reader.Get(hits)
+            || lives > livesStart_ || score > scoreMax_ || hits > SIZE_MAX)
+            return false;
 
-        const PointF pt(rect_.X + rect_.Width / 1.5f, rect_.Y + 5.f);
-        RectF strRect;
-        graphics->MeasureString(c_strLives, -1, &font, pt, &strRect);
+        const auto words = reader.Take(linesHits_.GetWords().size() * sizeof(Bitmask::TWord));
+        if (nullptr == words || !linesHits_.CheckWords(words))
+            return false;
 
-        graphics->DrawString(c_strLives, -1, &font, strRect, &sf, &brush);
+        if (!apply)
+            return true;
 
-        if (lives_ > 0)
-        {
-            const SolidBrush sb(Color::Red);
-            RectF rect;
-            rect.X = strRect.X + strRect.Width + 5;
-            rect.Y = strRect.Y;
-            rect.Width = 14.f;
-            rect.Height = 14.f;
-
-            for (size_t i = 0; i < lives_; ++i)
-            {
-                graphics->FillEllipse(&sb, rect);
-                rect.X += 20;
-            }
-        }
+        linesHits_.AssignWords(words);
+        lives_ = size_t(lives);
+        paused_ = paused;
+        hittop_ = hittop;
+        state_ = eState(state);
+        score_ = size_t(score);
+        hits_ = size_t(hits);
+        return true;
     }
 
 private:
+    enum class eState : uint8_t
+    {
+        undefined,
+        victory,
+        fail,
+    };
 
+    size_t livesStart_{}; // loaded lives and score are not above them, lives are drawn one by one
+    size_t scoreMax_{};
     size_t lives_{};
     bool    paused_ = true;
     eState  state_ = eState::undefined;
     size_t  score_ = 0;
     bool    hittop_ = false;
     size_t  hits_ = 0;
-    using   TLinesHits = std::set<size_t>;
-    TLinesHits linesHits_;
+    Bitmask linesHits_;
     float   height_{};
 };
 
@@ -309,41 +281,92 @@ public:
         SetColor(color);
     }
 
-    void Draw(Graphics* graphics, const RectF* rect) override final
+    void Layout(const RectF* rect) override final
     {
-        const SizeF size(rect->Width / REAL(positionsCount_), height_);
-
-        rect_.X = rect->GetLeft() + position_ * size.Width;
-        rect_.Y = rect->GetBottom() - size.Height;
-        rect_.Width = size.Width;
-        rect_.Height = size.Height;
-
-        const SolidBrush sb(color_);
-        graphics->FillRectangle(&sb, rect_);
+        parentRect_ = *rect;
+        LayoutPositions();
     }
 
-    void SplitBy(size_t split) noexcept
+    void SplitBy(size_t split)
     {
         positionsCount_ *= split;
         position_ *= split;
+        LayoutPositions();
     }
 
     void MoveLeft() noexcept
     {
         if (position_ > 0)
             --position_;
+        UpdateBounds();
     }
 
     void MoveRight() noexcept
     {
         if (position_ < positionsCount_ - 1)
             ++position_;
+        UpdateBounds();
+    }
+
+    // count of positions, position
+    static constexpr size_t c_StateSize = 4 + 4;
+
+    // count of positions is limited, so damaged state does not make layout allocate without end
+    static constexpr size_t c_MaxPositions = 1 << 16;
+
+    void SaveState(StateWriter& writer) const
+    {
+        writer.Add(uint32_t(positionsCount_));
+        writer.Add(uint32_t(position_));
+    }
+
+    // positions are laid out again only when their count (split) differs, with apply false state is only read and checked
+    bool LoadState(StateReader& reader, bool apply = true)
+    {
+        uint32_t positionsCount = 0;
+        uint32_t position = 0;
+        if (!reader.Get(positionsCount) || !reader.Get(position) || 0 == positionsCount || positionsCount > c_MaxPositions
+            || position >= positionsCount)
+            return false;
+
+        if (!apply)
+            return true;
+
+        position_ = position;
+        if (positionsCount != positionsCount_)
+        {
+            positionsCount_ = positionsCount;
+            LayoutPositions();
+        }
+        else
+            UpdateBounds();
+        return true;
     }
 
 private:
+
+    // bounds of every position, computed only when layout or count of positions changes
+    void LayoutPositions()
+    {
+        const SizeF size(parentRect_.Width / REAL(positionsCount_), height_);
+
+        positionBounds_.resize(positionsCount_);
+        for (size_t i = 0; i < positionsCount_; ++i)
+            positionBounds_[i] = RectF(parentRect_.GetLeft() + i * size.Width, parentRect_.GetBottom() - size.Height, size.Width, size.Height);
+
+        UpdateBounds();
+    }
+
+    void UpdateBounds() noexcept
+    {
+        rect_ = positionBounds_[position_];
+    }
+
     size_t positionsCount_{};
     size_t position_{};
     float height_{};
+    RectF parentRect_;
+    std::vector<RectF> positionBounds_;
 };
 
 //-------------------------------------------------------------------------------------------------------------------------------
@@ -351,34 +374,36 @@ class Ball
     : public VisualElement
 {
 public:
-    Ball(const Color& color, float radius, float speed, const PointF& direction, const PointF& start, float maxMovementStep)
+    // seed is seed of game, randomity of ricochets comes from it
+    Ball(const Color& color, float radius, float speed, const PointF& direction, const PointF& start, uint64_t seed)
         : radius_(radius)
         , speed_(speed)
-        , direction_(direction)
+        , direction_(Normalize(direction))
         , position_(start)
-        , maxStep_(maxMovementStep)
+        , random_(seed)
     {
         SetColor(color);
     }
 
-    void Draw(Graphics* graphics, const RectF* rect) override final
+    void Layout(const RectF* rect) override final
     {
-        const PointF realPoint(rect->GetLeft() + rect->Width * position_.X, rect->GetTop() + rect->Height * position_.Y);
-
-        rect_.X = realPoint.X - radius_;
-        rect_.Y = realPoint.Y - radius_;
-        rect_.Width = 2.f * radius_;
-        rect_.Height = 2.f * radius_;
-
-        const SolidBrush sb(color_);
-        graphics->FillEllipse(&sb, rect_);
-
         parentRect_ = *rect;
+        UpdateBounds();
     }
 
-    void CalcNextPosition()
+    // movement for whole tick in world units
+    PointF GetMovement() const noexcept
     {
-        position_ = CalcNextPos(speed_);
+        return PointF(direction_.X * speed_ * parentRect_.Width, direction_.Y * speed_ * parentRect_.Height);
+    }
+
+    // moves ball by part of tick movement, one multiply-add per axis (fused where target supports FMA)
+    void Move(float part) noexcept
+    {
+        const auto distance = speed_ * part;
+        position_.X += direction_.X * distance;
+        position_.Y += direction_.Y * distance;
+        UpdateBounds();
     }
 
     void SpeedUp(float mul) noexcept
@@ -386,13 +411,91 @@ public:
         speed_ *= mul;
     }
 
+    // position, direction, speed, generator, color (red once game is lost)
+    static constexpr size_t c_StateSize = 4 + 4 + 4 + 4 + 4 + 8 + 4;
+
+    void SaveState(StateWriter& writer) const
+    {
+        writer.Add(position_.X);
+        writer.Add(position_.Y);
+        writer.Add(direction_.X);
+        writer.Add(direction_.Y);
+        writer.Add(speed_);
+        writer.Add(random_.GetState());
+        writer.Add(uint32_t(color_.GetValue()));
+    }
+
+    // floats have to be finite, direction unit vector and speed not negative, element is left as it was when they are not
+    // with apply false state is only read and checked
+    bool LoadState(StateReader& reader, bool apply = true)
+    {
+        PointF position;
+        PointF direction;
+        float speed = 0.f;
+        uint64_t random = 0;
+        uint32_t color = 0;
+        if (!reader.GetFinite(position.X) || !reader.GetFinite(position.Y) || !reader.GetFinite(direction.X) || !reader.GetFinite(direction.Y)
+            || !reader.GetFinite(speed) || !reader.Get(random) || !reader.Get(color)
+            || speed < 0.f || std::abs(std::hypot(direction.X, direction.Y) - 1.f) > 1e-3f)
+            return false;
+
+        if (!apply)
+            return true;
+
+        position_ = position;
+        direction_ = direction;
+        speed_ = speed;
+        random_.SetState(random);
+        color_ = Color(ARGB(color));
+        UpdateBounds();
+        return true;
+    }
+
     enum class eHitType
     {
         hitInside,
         hitOutside,
     };
 
-    bool HitWithTarget(const IHasBounds* hasBounds)
+    // faces of target to test in priority order, see HitWithTarget
+    void GetTargetHitOrder(eHitFace& first, eHitFace& second) const noexcept
+    {
+        if (MovingUp())
+        {
+            first = eHitFace::bottom;
+            second = eHitFace::top;
+        }
+        else if (MovingDown())
+        {
+            first = eHitFace::top;
+            second = eHitFace::bottom;
+        }
+        else if (MovingLeft())
+        {
+            first = eHitFace::right;
+            second = eHitFace::left;
+        }
+        else if (MovingRight())
+        {
+            first = eHitFace::left;
+            second = eHitFace::right;
+        }
+        else
+        {
+            first = eHitFace::none;
+            second = eHitFace::none;
+        }
+    }
+
+    void HitWithFace(eHitFace face) noexcept
+    {
+        if (eHitFace::left == face || eHitFace::right == face)
+            InverseHorizontalMovement();
+        else if (eHitFace::top == face || eHitFace::bottom == face)
+            InverseVerticalMovement();
+    }
+
+    bool HitWithTarget(const RectF* other)
     {
         // hit priorities depends on movement direction
         eHitType ht = eHitType::hitOutside;
@@ -400,40 +503,58 @@ public:
         if (MovingLeft())
         {
             if (MovingUp())
-                return HitWithBottom(hasBounds, ht) || HitWithTop(hasBounds, ht);
+                return HitWithBottom(other, ht) || HitWithTop(other, ht);
             else if (MovingDown())
-                return HitWithTop(hasBounds, ht) || HitWithBottom(hasBounds, ht);
+                return HitWithTop(other, ht) || HitWithBottom(other, ht);
             else
-                return HitWithRight(hasBounds, ht) || HitWithLeft(hasBounds, ht);
+                return HitWithRight(other, ht) || HitWithLeft(other, ht);
         }
         else if (MovingRight())
         {
             if (MovingUp())
-                return HitWithBottom(hasBounds, ht) || HitWithTop(hasBounds, ht);
+                return HitWithBottom(other, ht) || HitWithTop(other, ht);
             else if (MovingDown())
-                return HitWithTop(hasBounds, ht) || HitWithBottom(hasBounds, ht);
+                return HitWithTop(other, ht) || HitWithBottom(other, ht);
             else
-                return HitWithLeft(hasBounds, ht) || HitWithRight(hasBounds, ht);
+                return HitWithLeft(other, ht) || HitWithRight(other, ht);
         }
         else
         {
             if (MovingUp())
-                return HitWithBottom(hasBounds, ht) || HitWithTop(hasBounds, ht);
+                return HitWithBottom(other, ht) || HitWithTop(other, ht);
             else if (MovingDown())
-                return HitWithTop(hasBounds, ht) || HitWithBottom(hasBounds, ht);
+                return HitWithTop(other, ht) || HitWithBottom(other, ht);
         }
 
         return false;
     }
 
     bool HitWithLeft(const IHasBounds* hasBounds, eHitType ht)
+    {
+        return HitWithLeft(hasBounds->GetBounds(), ht);
+    }
+
+    bool HitWithRight(const IHasBounds* hasBounds, eHitType ht)
+    {
+        return HitWithRight(hasBounds->GetBounds(), ht);
+    }
+
+    bool HitWithTop(const IHasBounds* hasBounds, eHitType ht)
+    {
+        return HitWithTop(hasBounds->GetBounds(), ht);
+    }
+
+    bool HitWithBottom(const IHasBounds* hasBounds, eHitType ht)
+    {
+        return HitWithBottom(hasBounds->GetBounds(), ht);
+    }
+
+    bool HitWithLeft(const RectF* other, eHitType ht)
     {
         const auto canHit = MovingLeft() || (eHitType::hitOutside == ht && MovingRight());
         if (!canHit)
             return false;
 
-        auto other = hasBounds->GetBounds();
-
         const bool res = rect_.IntersectsWith(RectF(other->GetLeft(), other->GetTop(), 0, other->Height));
         if (res)
             InverseHorizontalMovement();
@@ -441,14 +562,12 @@ public:
         return res;
     }
 
-    bool HitWithRight(const IHasBounds* hasBounds, eHitType ht)
+    bool HitWithRight(const RectF* other, eHitType ht)
     {
         const auto canHit = MovingRight() || (eHitType::hitOutside == ht && MovingLeft());
         if (!canHit)
             return false;
 
-        auto other = hasBounds->GetBounds();
-
         const auto res = rect_.IntersectsWith(RectF(other->GetRight(), other->GetTop(), 0, other->Height));
         if (res)
             InverseHorizontalMovement();
@@ -456,14 +575,12 @@ public:
         return res;
     }
 
-    bool HitWithTop(const IHasBounds* hasBounds, eHitType ht)
+    bool HitWithTop(const RectF* other, eHitType ht)
     {
         const auto canHit = MovingUp() || (eHitType::hitOutside == ht && MovingDown());
         if (!canHit)
             return false;
 
-        auto other = hasBounds->GetBounds();
-
         const auto res = rect_.IntersectsWith(RectF(other->GetLeft(), other->GetTop(), other->Width, 0));
         if (res)
             InverseVerticalMovement();
@@ -471,14 +588,12 @@ public:
         return res;
     }
 
-    bool HitWithBottom(const IHasBounds* hasBounds, eHitType ht)
+    bool HitWithBottom(const RectF* other, eHitType ht)
     {
         const auto canHit = MovingDown() || (eHitType::hitOutside == ht && MovingUp());
         if (!canHit)
             return false;
 
-        auto other = hasBounds->GetBounds();
-
         const auto res = rect_.IntersectsWith(RectF(other->GetLeft(), other->GetBottom(), other->Width, 0));
         if (res)
             InverseVerticalMovement();
@@ -508,54 +623,44 @@ public:
 
 private:
 
-    PointF CalcNextPos(float speed)
+    void UpdateBounds() noexcept
     {
-        PointF res = position_;
-        const auto angle = atanf(fabs(direction_.X) / fabs(direction_.Y));
-        auto dx = speed * sinf(angle);
-        auto dy = speed * cosf(angle);
-
-        if (std::signbit(direction_.X))
-            dx = -dx;
-        if (std::signbit(direction_.Y))
-            dy = -dy;
-
-        res.X += dx;
-        res.Y += dy;
-
-        const bool withinArea = (res.X >= 0.f && res.X <= 1.f && res.Y >= 0.f && res.Y <= 1.f);
+        const PointF realPoint(parentRect_.GetLeft() + parentRect_.Width * position_.X, parentRect_.GetTop() + parentRect_.Height * position_.Y);
 
-        if (!withinArea)
-            return CalcNextPos(speed / 2.f);
+        rect_.X = realPoint.X - radius_;
+        rect_.Y = realPoint.Y - radius_;
+        rect_.Width = 2.f * radius_;
+        rect_.Height = 2.f * radius_;
+    }
 
-        // adjust speed to max step allowed
-        const auto shift = sqrtf(pow(fabs(dx) * parentRect_.Width, 2.f) + pow(fabs(dy) * parentRect_.Height, 2.f));
-        if (shift > maxStep_)
-        {
-            speed_ *= (maxStep_ / shift);
-            return CalcNextPos(speed_);
-        }
+    static PointF Normalize(const PointF& vector) noexcept
+    {
+        const auto length = std::hypot(vector.X, vector.Y);
+        if (!(length > 0.f))
+            return vector;
 
-        return res;
+        return PointF(vector.X / length, vector.Y / length);
     }
 
+    // direction changes only here, so only here it has to be normalized again
     void InverseHorizontalMovement() noexcept
     {
         direction_.X = -direction_.X;
         direction_.X += GetRandomVectorAddittion();
+        direction_ = Normalize(direction_);
     }
 
     void InverseVerticalMovement() noexcept
     {
         direction_.Y = -direction_.Y;
         direction_.Y += GetRandomVectorAddittion();
+        direction_ = Normalize(direction_);
     }
 
-    static float GetRandomVectorAddittion() noexcept
+    float GetRandomVectorAddittion() noexcept
     {
         // to have some randomity in ricochet logic
-        auto val = std::rand();
-        val = val % 201; // 0 to 200
+        auto val = int(random_.Next(201)); // 0 to 200
         val -= 100; // -100 to 100
         const float add = val / 10000.f; // -0.01 to 0.01
         return add;
@@ -563,162 +668,405 @@ private:
 
     float speed_{};
     PointF position_;
-    PointF direction_;
+    PointF direction_; // unit vector
     float radius_{};
-    float maxStep_{};
     RectF parentRect_;
+    Random random_;
 };
 
 //-------------------------------------------------------------------------------------------------------------------------------
-class Target
-    : public VisualElement
+// uniform grid over targets layout, one cell per line and position
+// cell covers target rect and half of margins around it, so ball can hit only targets of cells its bounds overlap
+class TargetsGrid
 {
 public:
-    Target(size_t line, size_t pos, size_t cost, const Color& color)
-        : line_(line)
-        , pos_(pos)
-        , cost_(cost)
+    struct Range
     {
-        SetColor(color);
-    }
+        size_t lineFirst{};
+        size_t lineLast{};
+        size_t posFirst{};
+        size_t posLast{};
+    };
 
-    void Draw(Graphics* graphics, const RectF* rect) override final
+    void Reset(size_t lines, size_t lineSize) noexcept
     {
-        rect_ = *rect;
-        const SolidBrush sb(color_);
-        graphics->FillRectangle(&sb, rect_);
+        lines_ = lines;
+        lineSize_ = lineSize;
     }
 
-    size_t GetCost() const noexcept
+    void Layout(const RectF* rect, float margin, float topMargin, float targetHeight) noexcept
     {
-        return cost_;
+        cellWidth_ = (rect->Width - margin * (lineSize_ + 1)) / lineSize_ + margin;
+        cellHeight_ = targetHeight + margin;
+        left_ = rect->GetLeft() + margin / 2.f;
+        top_ = rect->GetTop() + topMargin - margin / 2.f;
     }
 
-    size_t GetLine() const noexcept
+    // cells overlapped by bounds, false if bounds are out of grid
+    bool GetRange(const RectF* bounds, Range& range) const noexcept
     {
-        return line_;
-    }
+        if (0 == lines_ || 0 == lineSize_ || cellWidth_ <= 0.f)
+            return false;
 
-    size_t GetPos() const noexcept
-    {
-        return pos_;
+        const auto colFirst = std::floor((bounds->GetLeft() - left_) / cellWidth_);
+        const auto colLast = std::floor((bounds->GetRight() - left_) / cellWidth_);
+        const auto rowFirst = std::floor((bounds->GetTop() - top_) / cellHeight_);
+        const auto rowLast = std::floor((bounds->GetBottom() - top_) / cellHeight_);
+
+        const auto cols = float(lineSize_);
+        const auto rows = float(lines_);
+
+        if (colLast < 0.f || colFirst >= cols || rowLast < 0.f || rowFirst >= rows)
+            return false;
+
+        range.posFirst = size_t(std::max(colFirst, 0.f));
+        range.posLast = size_t(std::min(colLast, cols - 1.f));
+
+        // rows go from top, lines from bottom
+        range.lineFirst = lines_ - 1 - size_t(std::min(rowLast, rows - 1.f));
+        range.lineLast = lines_ - 1 - size_t(std::max(rowFirst, 0.f));
+
+        return true;
     }
 
 private:
-    size_t line_{};
-    size_t pos_{};
-    size_t cost_{};
+    size_t lines_{};
+    size_t lineSize_{};
+    float left_{};
+    float top_{};
+    float cellWidth_{};
+    float cellHeight_{};
 };
 
 //-------------------------------------------------------------------------------------------------------------------------------
+// versions of targets are taken from one counter, so targets of new game or of other simulation never have same version
+inline std::atomic<uint64_t> g_TargetsVersions{ 0 };
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// targets are kept as packed arrays indexed by slot (line * targetsInLine + pos), alive ones are marked in bitmask
+// line is index of line in lines (from 0, in order of their keys), bounds, grid and hit lines all use it
+// slots never move, so target index stays valid until new game
 class Targets
-    : public IDrawable
+    : public ILayoutable
 {
 public:
     using TLines = std::map<size_t, std::pair<Color, size_t>>;
 
+    static constexpr size_t c_NoTarget = c_NoHit;
+
+    // lines and targets in line are limited to 16 bits, so count of slots fits 32 bits of saved state
+    static constexpr size_t c_MaxLines = UINT16_MAX;
+    static constexpr size_t c_MaxLineSize = size_t(UINT16_MAX) + 1;
+
+    // packed slot data is narrowed, so level which does not fit it is cut to what fits (asserted in debug build):
+    // lines and targets in line over limits are left out, costs are clamped, colors over 256 take last color of palette
     Targets(const TLines& lines, size_t targetsInLine, float margin, float topMargin, float targetHeight)
         : margin_(margin)
         , topMargin_(topMargin)
-        , lineSize_(targetsInLine)
+        , lineSize_(std::min(targetsInLine, c_MaxLineSize))
         , targetHeight_(targetHeight)
     {
-        linesBase_ = lines.size();
-        for (const auto& line : lines)
+        assert(lines.size() <= c_MaxLines && targetsInLine <= c_MaxLineSize);
+
+        linesBase_ = std::min(lines.size(), c_MaxLines);
+
+        const auto count = linesBase_ * lineSize_;
+        lines_.reserve(count);
+        positions_.reserve(count);
+        costs_.reserve(count);
+        colors_.reserve(count);
+
+        auto line = lines.begin();
+        for (size_t index = 0; index < linesBase_; ++index, ++line)
         {
-            targets_.emplace_back(std::vector< Target >());
+            const auto cost = line->second.second;
+            assert(cost <= UINT16_MAX);
 
-            auto& newLine = targets_.back();
+            const auto color = line->second.first;
+            auto it = std::find_if(palette_.begin(), palette_.end(), [&color](const auto& elem) { return elem.GetValue() == color.GetValue(); });
+            if (palette_.end() == it)
+            {
+                assert(palette_.size() <= UINT8_MAX);
+                it = palette_.size() <= UINT8_MAX ? palette_.insert(palette_.end(), color) : palette_.end() - 1;
+            }
 
-            for (size_t j = 0; j < targetsInLine; ++j)
+            for (size_t j = 0; j < lineSize_; ++j)
             {
-                newLine.emplace_back(Target(line.first, j, line.second.second, line.second.first));
+                lines_.push_back(uint16_t(index));
+                positions_.push_back(uint16_t(j));
+                costs_.push_back(uint16_t(std::min(cost, size_t(UINT16_MAX))));
+                colors_.push_back(uint8_t(it - palette_.begin()));
             }
         }
+
+        alive_.Assign(count, true);
+        aliveCount_ = count;
+
+        grid_.Reset(linesBase_, lineSize_);
+        Changed();
     }
 
-    void Draw(Graphics* graphics, const RectF* rect) override final
+    // bounds of all slots are computed here only, drawing and collision read them
+    void Layout(const RectF* rect) override final
     {
-        for (size_t i = 0; i < targets_.size(); ++i)
+        rect_ = *rect;
+        targetWidth_ = (rect->Width - margin_ * (lineSize_ + 1)) / lineSize_;
+
+        bounds_.resize(lines_.size());
+        rects_.Resize(lines_.size());
+        for (size_t i = 0; i < lines_.size(); ++i)
         {
-            auto& line = targets_[i];
+            bounds_[i] = ComputeBounds(i);
+            rects_.Set(i, bounds_[i]);
+        }
 
-            for (size_t j = 0; j < line.size(); ++j)
-            {
-                auto& target = line[j];
+        grid_.Layout(rect, margin_, topMargin_, targetHeight_);
+        Changed();
+    }
 
-                RectF targetRect;
-                targetRect.Width = (rect->Width - margin_ * (lineSize_ + 1)) / lineSize_;
-                targetRect.Height = targetHeight_;
-                targetRect.X = rect->GetLeft() + (margin_ * (target.GetPos() + 1)) + targetRect.Width * target.GetPos();
-                targetRect.Y = rect->GetTop() + topMargin_ + (targetRect.Height + margin_) * (linesBase_ - target.GetLine() - 1);
+    // changes whenever alive targets or their bounds change, frames with same version have same targets
+    uint64_t GetVersion() const noexcept
+    {
+        return version_;
+    }
 
-                target.Draw(graphics, &targetRect);
-            }
-        }
+    // alive targets in slot order
+    void Capture(std::vector<ShapeSnapshot>& targets) const
+    {
+        targets.clear();
+        alive_.ForEach([this, &targets](size_t target)
+            {
+                targets.push_back({ bounds_[target], palette_[colors_[target]] });
+            });
     }
 
-    const Target* GetTargetHitWithBall(Ball* ball)
+    // grid narrows query to cells under ball, 1 - 3 targets per line, so game path ends in scalar tail of batched kernels
+    // (see collision.h), their 8 or 16 wide loops pay off only on longer spans, e.g. whole lines
+    size_t GetTargetHitWithBall(Ball* ball)
     {
+        ProfileScope profile(eProfilePhase::targetHit);
+
+        TargetsGrid::Range range;
+        if (!grid_.GetRange(ball->GetBounds(), range))
+            return c_NoTarget;
+
         if (ball->MovingDown())
         {
             // moving down - start search target from top lines
-            for (auto it = targets_.rbegin(); it != targets_.rend(); ++it)
+            for (size_t line = range.lineLast + 1; line-- > range.lineFirst; )
             {
-                for (auto& target : *it)
-                {
-                    if (ball->HitWithTarget(&target))
-                    {
-                        return &target;
-                    }
-                }
+                const auto target = GetTargetHitWithBall(ball, line, range);
+                if (c_NoTarget != target)
+                    return target;
             }
         }
         else
         {
             // not moving down - start search target from bottom lines
-            for (auto& line : targets_)
+            for (size_t line = range.lineFirst; line <= range.lineLast; ++line)
             {
-                for (auto& target : line)
-                {
-                    if (ball->HitWithTarget(&target))
-                    {
-                        return &target;
-                    }
-                }
+                const auto target = GetTargetHitWithBall(ball, line, range);
+                if (c_NoTarget != target)
+                    return target;
             }
         }
-        return nullptr;
+        return c_NoTarget;
     }
 
-    bool IsEmpty() const noexcept
+    // earliest contact of ball moving by movement with alive target within [0, maxTime]
+    // on same time targets go in same order as in GetTargetHitWithBall
+    size_t GetFirstContact(const Ball* ball, const PointF& movement, float maxTime, float& time, eHitFace& face) const
     {
-        return targets_.empty();
-    }
+        const auto bounds = ball->GetBounds();
 
-    void RemoveTarget(const Target* target)
-    {
-        for (auto it1 = targets_.begin(); it1 != targets_.end(); ++it1)
+        RectF swept;
+        RectF::Union(swept, *bounds, RectF(bounds->X + movement.X * maxTime, bounds->Y + movement.Y * maxTime, bounds->Width, bounds->Height));
+
+        TargetsGrid::Range range;
+        if (!grid_.GetRange(&swept, range))
+            return c_NoTarget;
+
+        size_t res = c_NoTarget;
+
+        const auto testLine = [&](size_t line)
         {
-            auto it = std::find_if(it1->begin(), it1->end(), [target](const auto& elem) { return &elem == target; });
-            if (it1->end() != it)
-            {
-                it1->erase(it);
+            const auto lineBegin = line * lineSize_;
+
+            float t = 0.f;
+            eHitFace f = eHitFace::none;
+            const auto target = FindFirstContact(rects_, alive_, lineBegin + range.posFirst, lineBegin + range.posLast + 1,
+                *bounds, movement, maxTime, t, f);
 
-                if (it1->empty())
-                {
-                    targets_.erase(it1);
-                }
-                break;
+            if (c_NoTarget != target && (c_NoTarget == res || t < time))
+            {
+                res = target;
+                time = t;
+                face = f;
+                maxTime = t;
             }
+        };
+
+        if (ball->MovingDown())
+        {
+            for (size_t line = range.lineLast + 1; line-- > range.lineFirst; )
+                testLine(line);
         }
+        else
+        {
+            for (size_t line = range.lineFirst; line <= range.lineLast; ++line)
+                testLine(line);
+        }
+
+        return res;
+    }
+
+    const RectF& GetBounds(size_t target) const noexcept
+    {
+        return bounds_[target];
+    }
+
+    size_t GetCost(size_t target) const noexcept
+    {
+        return costs_[target];
+    }
+
+    size_t GetLine(size_t target) const noexcept
+    {
+        return lines_[target];
+    }
+
+    size_t GetPos(size_t target) const noexcept
+    {
+        return positions_[target];
+    }
+
+    const Color& GetColor(size_t target) const noexcept
+    {
+        return palette_[colors_[target]];
+    }
+
+    bool IsEmpty() const noexcept
+    {
+        return 0 == aliveCount_;
+    }
+
+    bool IsAlive(size_t target) const noexcept
+    {
+        return alive_.Test(target);
+    }
+
+    void RemoveTarget(size_t target) noexcept
+    {
+        if (!alive_.Test(target))
+            return;
+
+        alive_.Reset(target);
+        --aliveCount_;
+        Changed();
+    }
+
+    // only alive set is state, slots and their bounds stay as they are
+    // count of alive targets, then words of alive set
+    static constexpr size_t c_StateSize = 4;
+
+    size_t GetStateSize() const noexcept
+    {
+        return c_StateSize + alive_.GetWords().size() * sizeof(Bitmask::TWord);
+    }
+
+    void SaveState(StateWriter& writer) const
+    {
+        const auto& words = alive_.GetWords();
+        writer.Add(uint32_t(aliveCount_));
+        writer.AddBytes(words.data(), words.size() * sizeof(Bitmask::TWord));
+    }
+
+    // count has to be that of alive set, element is left as it was when it is not
+    // with apply false state is only read and checked
+    bool LoadState(StateReader& reader, bool apply = true)
+    {
+        uint32_t aliveCount = 0;
+        const uint8_t* words = nullptr;
+        if (!reader.Get(aliveCount) || nullptr == (words = reader.Take(alive_.GetWords().size() * sizeof(Bitmask::TWord)))
+            || !alive_.CheckWords(words) || alive_.CountWords(words) != aliveCount)
+            return false;
+
+        if (!apply)
+            return true;
+
+        alive_.AssignWords(words);
+        aliveCount_ = aliveCount;
+        Changed();
+        return true;
+    }
+
+    size_t GetCount() const noexcept
+    {
+        return lines_.size();
+    }
+
+    // kernel of hit tests, best for current CPU by default, other levels are set by checks
+    void SetFindFirstHit(TFindFirstHit findFirstHit) noexcept
+    {
+        findFirstHit_ = findFirstHit;
     }
 
 private:
-    std::vector<std::vector< Target > > targets_;
+    void Changed() noexcept
+    {
+        version_ = g_TargetsVersions.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    RectF ComputeBounds(size_t target) const noexcept
+    {
+        const auto pos = positions_[target];
+
+        RectF targetRect;
+        targetRect.Width = targetWidth_;
+        targetRect.Height = targetHeight_;
+        targetRect.X = rect_.GetLeft() + (margin_ * (pos + 1)) + targetRect.Width * pos;
+        targetRect.Y = rect_.GetTop() + topMargin_ + (targetRect.Height + margin_) * (linesBase_ - lines_[target] - 1);
+        return targetRect;
+    }
+
+    size_t GetTargetHitWithBall(Ball* ball, size_t line, const TargetsGrid::Range& range) const
+    {
+        eHitFace first = eHitFace::none;
+        eHitFace second = eHitFace::none;
+        ball->GetTargetHitOrder(first, second);
+
+        const auto lineBegin = line * lineSize_;
+
+        eHitFace face = eHitFace::none;
+        const auto target = findFirstHit_(rects_, alive_, lineBegin + range.posFirst, lineBegin + range.posLast + 1,
+            *ball->GetBounds(), first, second, face);
+
+        if (c_NoTarget != target)
+            ball->HitWithFace(face);
+
+        return target;
+    }
+
+    // packed per slot data
+    std::vector<uint16_t> lines_;
+    std::vector<uint16_t> positions_;
+    std::vector<uint16_t> costs_;
+    std::vector<uint8_t> colors_; // index in palette
+    std::vector<Color> palette_;
+    Bitmask alive_;
+    size_t aliveCount_{};
+
+    // layout, bounds per slot and same of them packed for collision kernels
+    std::vector<RectF> bounds_;
+    TargetsGrid grid_;
+    TargetRects rects_;
+    TFindFirstHit findFirstHit_ = GetFindFirstHit();
+    RectF rect_;
+    float targetWidth_{};
     float margin_{};
     float topMargin_{};
     float targetHeight_{};
     size_t lineSize_{};
     size_t linesBase_{};
+    uint64_t version_{}; // see GetVersion
 };
@@ -0,0 +1,41 @@
+#pragma once
+
+// pre-rasterized fonts for software rendering, 8 bit coverage per pixel
+// glyph data is generated offline by tools/makefont.py into fontdata.h
+
+struct GlyphInfo
+{
+    uint32_t offset; // first coverage byte
+    uint8_t width;
+    uint8_t height;
+    int8_t left; // from pen position to left of bitmap
+    int8_t top; // from baseline up to top of bitmap
+    uint16_t advance; // pen advance, 1/64 pixel
+};
+
+struct FontData
+{
+    float size; // em size, pixels
+    float ascent; // from top of line to baseline, pixels
+    float lineHeight; // pixels
+    uint32_t first; // code of first glyph
+    uint32_t count;
+    const GlyphInfo* glyphs;
+    const uint8_t* coverage;
+
+    // glyph of character, '?' for characters without glyph
+    const GlyphInfo& GetGlyph(wchar_t ch) const noexcept
+    {
+        const auto code = uint32_t(ch);
+        if (code >= first && code < first + count)
+            return glyphs[code - first];
+        return glyphs[uint32_t(L'?') - first];
+    }
+
+    float GetAdvance(wchar_t ch) const noexcept
+    {
+        return GetGlyph(ch).advance / 64.f;
+    }
+};
+
+#include "fontdata.h"
@@ -0,0 +1,733 @@
+#pragma once
+
+// generated by tools/makefont.py from DejaVuSans.ttf, do not edit
+
+inline constexpr GlyphInfo c_FontTextGlyphs[] = {
+    { 0, 0, 0, 0, 0, 285 }, // ' '
+    { 0, 2, 11, 2, 11, 359 }, // '!'
+    { 22, 5, 5, 1, 11, 412 }, // '"'
+    { 47, 10, 11, 1, 11, 751 }, // '#'
+    { 157, 7, 14, 1, 11, 570 }, // '$'
+    { 255, 13, 12, 0, 11, 851 }, // '%'
+    { 411, 11, 12, 0, 11, 699 }, // '&'
+    { 543, 2, 5, 1, 11, 246 }, // "'"
+    { 553, 4, 13, 1, 11, 350 }, // '('
+    { 605, 4, 13, 1, 11, 350 }, // ')'
+    { 657, 7, 7, 0, 11, 448 }, // '*'
+    { 706, 10, 9, 1, 9, 751 }, // '+'
+    { 796, 3, 4, 1, 2, 285 }, // ','
+    { 808, 5, 2, 0, 5, 323 }, // '-'
+    { 818, 2, 2, 1, 2, 285 }, // '.'
+    { 822, 5, 13, 0, 11, 302 }, // '/'
+    { 887, 8, 12, 0, 11, 570 }, // '0'
+    { 983, 7, 11, 1, 11, 570 }, // '1'
+    { 1060, 7, 11, 1, 11, 570 }, // '2'
+    { 1137, 7, 12, 1, 11, 570 }, // '3'
+    { 1221, 9, 11, 0, 11, 570 }, // '4'
+    { 1320, 7, 12, 1, 11, 570 }, // '5'
+    { 1404, 9, 12, 0, 11, 570 }, // '6'
+    { 1512, 7, 11, 1, 11, 570 }, // '7'
+    { 1589, 8, 12, 0, 11, 570 }, // '8'
+    { 1685, 8, 12, 0, 11, 570 }, // '9'
+    { 1781, 3, 8, 1, 8, 302 }, // ':'
+    { 1805, 3, 10, 1, 8, 302 }, // ';'
+    { 1835, 10, 9, 1, 9, 751 }, // '<'
+    { 1925, 10, 5, 1, 7, 751 }, // '='
+    { 1975, 10, 9, 1, 9, 751 }, // '>'
+    { 2065, 6, 11, 1, 11, 476 }, // '?'
+    { 2131, 14, 13, 0, 10, 896 }, // '@'
+    { 2313, 10, 11, 0, 11, 613 }, // 'A'
+    { 2423, 8, 11, 1, 11, 615 }, // 'B'
+    { 2511, 10, 12, 0, 11, 626 }, // 'C'
+    { 2631, 9, 11, 1, 11, 690 }, // 'D'
+    { 2730, 7, 11, 1, 11, 566 }, // 'E'
+    { 2807, 7, 11, 1, 11, 515 }, // 'F'
+    { 2884, 10, 12, 0, 11, 694 }, // 'G'
+    { 3004, 9, 11, 1, 11, 674 }, // 'H'
+    { 3103, 2, 11, 1, 11, 264 }, // 'I'
+    { 3125, 4, 14, -1, 11, 264 }, // 'J'
+    { 3181, 9, 11, 1, 11, 588 }, // 'K'
+    { 3280, 7, 11, 1, 11, 499 }, // 'L'
+    { 3357, 10, 11, 1, 11, 773 }, // 'M'
+    { 3467, 9, 11, 1, 11, 670 }, // 'N'
+    { 3566, 11, 12, 0, 11, 705 }, // 'O'
+    { 3698, 7, 11, 1, 11, 540 }, // 'P'
+    { 3775, 11, 13, 0, 11, 705 }, // 'Q'
+    { 3918, 9, 11, 1, 11, 623 }, // 'R'
+    { 4017, 9, 12, 0, 11, 569 }, // 'S'
+    { 4125, 10, 11, -1, 11, 547 }, // 'T'
+    { 4235, 9, 12, 1, 11, 656 }, // 'U'
+    { 4343, 10, 11, 0, 11, 613 }, // 'V'
+    { 4453, 14, 11, 0, 11, 886 }, // 'W'
+    { 4607, 10, 11, 0, 11, 614 }, // 'X'
+    { 4717, 10, 11, -1, 11, 547 }, // 'Y'
+    { 4827, 9, 11, 0, 11, 614 }, // 'Z'
+    { 4926, 4, 13, 1, 11, 350 }, // '['
+    { 4978, 5, 13, 0, 11, 302 }, // '\\'
+    { 5043, 4, 13, 1, 11, 350 }, // ']'
+    { 5095, 10, 5, 1, 11, 751 }, // '^'
+    { 5145, 9, 2, -1, -2, 448 }, // '_'
+    { 5163, 4, 4, 1, 12, 448 }, // '`'
+    { 5179, 8, 9, 0, 8, 549 }, // 'a'
+    { 5251, 8, 12, 1, 11, 569 }, // 'b'
+    { 5347, 7, 9, 0, 8, 493 }, // 'c'
+    { 5410, 8, 12, 0, 11, 569 }, // 'd'
+    { 5506, 8, 9, 0, 8, 551 }, // 'e'
+    { 5578, 6, 11, 0, 11, 315 }, // 'f'
+    { 5644, 8, 11, 0, 8, 569 }, // 'g'
+    { 5732, 7, 11, 1, 11, 568 }, // 'h'
+    { 5809, 2, 11, 1, 11, 249 }, // 'i'
+    { 5831, 4, 14, -1, 11, 249 }, // 'j'
+    { 5887, 8, 11, 1, 11, 519 }, // 'k'
+    { 5975, 2, 11, 1, 11, 249 }, // 'l'
+    { 5997, 12, 8, 1, 8, 873 }, // 'm'
+    { 6093, 7, 8, 1, 8, 568 }, // 'n'
+    { 6149, 8, 9, 0, 8, 548 }, // 'o'
+    { 6221, 8, 11, 1, 8, 569 }, // 'p'
+    { 6309, 8, 11, 0, 8, 569 }, // 'q'
+    { 6397, 5, 8, 1, 8, 368 }, // 'r'
+    { 6437, 7, 9, 0, 8, 467 }, // 's'
+    { 6500, 6, 10, 0, 10, 351 }, // 't'
+    { 6560, 7, 9, 1, 8, 568 }, // 'u'
+    { 6623, 8, 8, 0, 8, 530 }, // 'v'
+    { 6687, 11, 8, 0, 8, 733 }, // 'w'
+    { 6775, 8, 8, 0, 8, 530 }, // 'x'
+    { 6839, 8, 11, 0, 8, 530 }, // 'y'
+    { 6927, 7, 8, 0, 8, 470 }, // 'z'
+    { 6983, 7, 14, 1, 11, 570 }, // '{'
+    { 7081, 2, 15, 1, 11, 302 }, // '|'
+    { 7111, 7, 14, 1, 11, 570 }, // '}'
+    { 7209, 10, 3, 1, 6, 751 }, // '~'
+};
+
+inline constexpr uint8_t c_FontTextCoverage[] = {
+    42,24,226,128,226,128,226,128,226,128,222,124,208,110,134,67,0,0,170,96,226,128,31,24,
+    3,48,4,167,130,18,255,24,167,130,18,255,24,167,130,18,255,24,94,73,10,143,13,0,
+    0,0,0,16,2,0,14,4,0,0,0,0,28,246,7,9,247,24,0,0,0,0,91,190,
+    0,66,215,0,0,7,48,48,168,155,48,149,176,48,31,29,207,207,253,214,207,248,219,207,
+    136,0,0,27,247,8,8,247,25,0,0,0,0,91,191,0,64,217,0,0,0,205,223,239,
+    243,223,235,246,223,194,0,44,48,229,94,48,208,115,48,42,0,0,26,246,7,8,247,25,
+    0,0,0,0,90,191,0,64,216,0,0,0,0,0,0,0,109,0,0,0,0,0,0,179,
+    1,0,0,19,165,240,250,248,203,20,162,190,18,174,10,78,17,209,117,0,174,0,0,0,
+    147,230,103,186,5,0,0,6,118,203,254,244,153,12,0,0,0,179,70,228,142,0,0,0,
+    174,0,140,186,133,60,5,175,51,221,125,114,204,247,254,222,131,5,0,0,0,176,0,0,
+    0,0,0,0,175,0,0,0,0,0,0,11,0,0,0,0,3,76,88,15,0,0,0,0,
+    79,26,0,0,0,169,183,152,220,14,0,0,62,212,5,0,0,31,244,9,0,188,98,0,
+    4,210,64,0,0,0,55,222,0,0,157,122,0,114,165,0,0,0,0,20,246,24,2,207,
+    83,26,228,25,0,0,0,0,0,121,222,204,180,4,166,113,1,64,84,14,0,0,0,21,
+    33,0,65,209,4,152,195,153,221,17,0,0,0,0,5,213,61,20,249,16,0,180,106,0,
+    0,0,0,118,161,0,45,234,0,0,147,132,0,0,0,28,228,23,0,14,247,30,0,195,
+    95,0,0,0,170,109,0,0,0,117,221,196,194,8,0,0,1,48,3,0,0,0,0,26,
+    41,1,0,0,0,0,36,92,86,30,0,0,0,0,0,0,96,251,193,192,248,23,0,0,
+    0,0,0,225,129,0,0,23,8,0,0,0,0,0,227,117,0,0,0,0,0,0,0,0,
+    0,131,242,50,0,0,0,0,0,0,0,45,236,195,236,46,0,0,36,125,0,0,204,148,
+    2,159,234,42,0,103,212,0,22,255,60,0,3,164,231,39,187,123,0,14,253,86,0,0,
+    4,169,237,228,14,0,0,171,225,52,0,7,109,255,227,33,0,0,14,167,253,241,249,205,
+    65,179,223,31,0,0,0,17,48,29,0,0,0,0,0,31,24,167,130,167,130,167,130,94,
+    73,0,4,147,27,0,104,191,0,3,224,81,0,70,243,7,0,141,189,0,0,185,152,0,
+    0,202,138,0,0,191,147,0,0,152,180,0,0,87,234,2,0,11,240,61,0,0,133,165,
+    0,0,15,205,29,113,65,0,0,74,217,4,0,1,218,89,0,0,133,187,0,0,72,249,
+    9,0,34,255,48,0,20,255,64,0,29,255,53,0,62,254,17,0,118,205,0,0,198,113,
+    0,48,236,14,0,146,103,0,0,0,0,0,75,0,0,0,10,2,0,199,0,2,10,77,
+    189,49,199,49,189,77,0,26,165,246,165,26,0,8,116,181,224,181,116,8,79,100,1,199,
+    1,100,79,0,0,0,199,0,0,0,0,0,0,0,136,84,0,0,0,0,0,0,0,0,
+    181,112,0,0,0,0,0,0,0,0,181,112,0,0,0,0,0,0,0,0,181,112,0,0,
+    0,0,132,255,255,255,255,255,255,255,255,63,25,48,48,48,195,139,48,48,48,12,0,0,
+    0,0,181,112,0,0,0,0,0,0,0,0,181,112,0,0,0,0,0,0,0,0,181,112,
+    0,0,0,0,69,191,16,102,245,11,161,138,0,133,20,0,30,96,96,96,35,61,191,191,
+    191,70,96,180,128,240,0,0,0,23,33,0,0,0,169,127,0,0,7,241,48,0,0,72,
+    224,1,0,0,151,146,0,0,1,228,67,0,0,53,238,5,0,0,132,164,0,0,0,211,
+    86,0,0,35,248,14,0,0,113,183,0,0,0,192,104,0,0,0,76,16,0,0,0,0,
+    0,2,64,96,56,0,0,0,7,186,236,184,242,165,2,0,116,237,26,0,40,247,90,0,
+    206,148,0,0,0,171,181,3,250,99,0,0,0,123,228,17,255,82,0,0,0,105,246,15,
+    255,83,0,0,0,107,244,1,246,106,0,0,0,129,221,0,193,162,0,0,0,186,168,0,
+    91,248,57,0,75,253,66,0,0,138,250,234,248,117,0,0,0,0,18,48,14,0,0,0,
+    0,28,48,17,0,0,90,231,255,255,92,0,0,59,89,40,255,92,0,0,0,0,2,255,
+    92,0,0,0,0,2,255,92,0,0,0,0,2,255,92,0,0,0,0,2,255,92,0,0,
+    0,0,2,255,92,0,0,0,0,2,255,92,0,0,13,48,49,255,122,48,29,67,255,255,
+    255,255,255,157,0,45,91,91,38,0,0,204,250,207,211,254,145,0,103,18,0,0,92,255,
+    67,0,0,0,0,0,245,111,0,0,0,0,41,255,71,0,0,0,7,198,192,1,0,0,
+    5,175,215,22,0,0,4,169,220,27,0,0,3,167,223,30,0,0,0,162,244,81,48,48,
+    48,24,249,255,255,255,255,255,129,7,55,91,94,54,1,0,159,242,204,206,251,189,10,28,
+    3,0,0,45,248,108,0,0,0,0,0,218,132,0,0,0,13,99,246,49,0,43,255,255,
+    248,93,0,0,5,32,39,119,249,76,0,0,0,0,0,173,185,0,0,0,0,0,167,190,
+    99,26,0,8,92,248,112,199,255,248,255,243,133,2,0,18,47,41,6,0,0,0,0,0,
+    0,7,48,32,0,0,0,0,0,0,136,255,170,0,0,0,0,0,52,227,197,170,0,0,
+    0,0,6,210,84,181,170,0,0,0,0,129,176,0,181,170,0,0,0,46,235,27,0,181,
+    170,0,0,4,204,104,0,0,181,170,0,0,75,248,145,143,143,223,218,143,17,45,143,143,
+    143,143,223,218,143,17,0,0,0,0,0,181,170,0,0,0,0,0,0,0,181,170,0,0,
+    23,48,48,48,48,45,0,125,251,239,239,239,223,0,125,198,0,0,0,0,0,125,198,0,
+    0,0,0,0,125,231,180,183,127,19,0,102,148,112,129,227,221,19,0,0,0,0,25,241,
+    125,0,0,0,0,0,184,170,0,0,0,0,0,211,155,97,26,0,15,137,254,66,208,255,
+    249,255,234,99,0,0,22,48,38,3,0,0,0,0,0,18,83,94,59,4,0,0,0,88,
+    243,224,199,240,92,0,0,49,250,102,0,0,5,18,0,0,165,190,0,0,0,0,0,0,
+    0,230,126,121,187,169,74,0,0,3,254,234,178,97,143,253,93,0,2,254,215,3,0,0,
+    156,218,0,0,232,159,0,0,0,97,254,3,0,177,179,0,0,0,117,242,0,0,71,250,
+    67,0,32,224,156,0,0,0,116,247,232,252,177,14,0,0,0,0,13,47,25,0,0,0,
+    41,48,48,48,48,48,34,204,239,239,239,239,254,163,0,0,0,0,41,255,71,0,0,0,
+    0,139,226,3,0,0,0,5,232,130,0,0,0,0,81,253,33,0,0,0,0,179,189,0,
+    0,0,0,26,251,90,0,0,0,0,121,238,9,0,0,0,1,218,149,0,0,0,0,62,
+    255,51,0,0,0,0,0,11,76,96,71,7,0,0,46,231,225,182,231,221,31,0,177,204,
+    6,0,13,222,151,0,200,150,0,0,0,173,174,0,115,226,35,0,48,238,89,0,0,147,
+    255,240,253,124,0,0,120,234,86,45,97,241,97,3,243,112,0,0,0,136,221,7,254,98,
+    0,0,0,122,235,0,198,206,24,0,34,221,172,0,37,205,251,231,253,191,25,0,0,0,
+    30,48,25,0,0,0,0,11,79,94,46,0,0,0,46,230,220,185,245,143,0,0,204,184,
+    4,0,47,250,72,18,255,84,0,0,0,193,165,23,255,78,0,0,0,187,213,1,225,158,
+    0,0,25,243,232,0,80,250,181,147,225,212,229,0,0,40,120,132,59,154,196,0,0,0,
+    0,0,7,229,122,0,43,32,0,24,168,226,16,0,102,253,250,255,201,39,0,0,0,16,
+    47,30,0,0,0,23,64,5,92,255,21,46,128,11,0,0,0,0,0,0,0,0,0,69,
+    191,16,92,255,21,23,64,5,92,255,21,46,128,11,0,0,0,0,0,0,0,0,0,69,
+    191,16,102,245,11,161,138,0,133,20,0,0,0,0,0,0,0,0,0,1,6,0,0,0,
+    0,0,0,36,128,220,63,0,0,0,19,105,198,252,186,96,10,7,83,175,249,203,113,25,
+    0,0,0,131,255,196,42,0,0,0,0,0,0,36,139,229,231,144,54,0,0,0,0,0,
+    0,3,70,162,243,218,129,39,0,0,0,0,0,0,11,92,184,252,58,0,0,0,0,0,
+    0,0,0,25,20,49,96,96,96,96,96,96,96,96,24,107,207,207,207,207,207,207,207,207,
+    51,0,0,0,0,0,0,0,0,0,0,74,143,143,143,143,143,143,143,143,35,74,143,143,
+    143,143,143,143,143,143,35,6,0,0,0,0,0,0,0,0,0,131,195,103,17,0,0,0,
+    0,0,0,26,120,211,248,173,80,6,0,0,0,0,0,0,47,138,227,237,151,58,1,0,
+    0,0,0,0,2,78,230,255,62,0,0,0,6,79,169,246,207,115,14,2,63,153,238,228,
+    137,45,0,0,0,127,242,160,67,2,0,0,0,0,0,35,10,0,0,0,0,0,0,0,
+    0,3,61,96,75,6,0,220,228,192,241,209,13,91,2,0,34,252,98,0,0,0,15,249,
+    96,0,0,8,183,208,10,0,1,178,210,21,0,0,53,255,38,0,0,0,73,255,5,0,
+    0,0,18,64,1,0,0,0,63,191,12,0,0,0,83,255,15,0,0,0,0,0,0,71,
+    162,208,217,184,107,10,0,0,0,0,0,15,180,206,99,44,35,73,164,221,46,0,0,0,
+    4,194,140,3,0,0,0,0,0,78,227,25,0,0,105,179,0,0,102,184,166,58,145,0,
+    125,151,0,0,207,53,0,103,225,85,83,212,233,0,24,232,0,7,240,1,0,202,88,0,
+    0,78,233,0,0,248,3,17,229,0,0,222,58,0,0,47,233,0,21,233,0,2,240,11,
+    0,180,124,0,0,113,233,0,142,141,0,0,176,94,0,52,239,170,166,203,245,194,172,9,
+    0,0,56,226,24,0,27,93,77,12,98,43,0,0,0,0,0,114,216,52,0,0,0,0,
+    38,104,0,0,0,0,0,0,82,223,199,149,147,190,230,104,0,0,0,0,0,0,0,3,
+    59,104,106,67,6,0,0,0,0,0,0,0,2,48,29,0,0,0,0,0,0,0,67,255,
+    214,0,0,0,0,0,0,0,165,191,252,56,0,0,0,0,0,16,246,74,183,154,0,0,
+    0,0,0,104,231,4,88,241,10,0,0,0,0,202,141,0,9,240,93,0,0,0,44,255,
+    47,0,0,155,190,0,0,0,141,252,191,191,191,215,254,34,0,5,233,157,96,96,96,96,
+    222,130,0,81,253,27,0,0,0,0,129,225,2,178,189,0,0,0,0,0,39,255,69,30,
+    48,48,48,43,6,0,0,160,251,239,239,249,240,96,0,160,192,0,0,6,145,249,18,160,
+    192,0,0,0,56,255,44,160,192,0,0,17,157,226,6,160,255,255,255,255,237,59,0,160,
+    200,32,32,42,139,239,37,160,192,0,0,0,1,230,137,160,192,0,0,0,1,231,148,160,
+    200,32,32,44,143,255,72,160,255,255,255,250,208,92,0,0,0,0,7,65,96,88,35,0,
+    0,0,0,81,232,238,195,203,250,184,2,0,65,252,135,6,0,0,22,160,4,0,201,188,
+    0,0,0,0,0,0,0,21,254,99,0,0,0,0,0,0,0,50,255,66,0,0,0,0,
+    0,0,0,47,255,69,0,0,0,0,0,0,0,13,251,111,0,0,0,0,0,0,0,0,
+    181,210,5,0,0,0,0,6,1,0,40,240,179,38,0,3,66,202,4,0,0,44,190,254,
+    244,249,236,132,1,0,0,0,0,17,47,38,3,0,0,30,48,48,48,33,3,0,0,0,
+    160,251,239,239,252,242,160,27,0,160,192,0,0,6,69,211,227,22,160,192,0,0,0,0,
+    23,242,140,160,192,0,0,0,0,0,167,211,160,192,0,0,0,0,0,133,239,160,192,0,
+    0,0,0,0,137,236,160,192,0,0,0,0,0,181,200,160,192,0,0,0,0,49,251,116,
+    160,200,32,32,57,122,239,193,7,160,255,255,255,235,192,106,5,0,30,48,48,48,48,48,
+    40,160,251,239,239,239,239,198,160,192,0,0,0,0,0,160,192,0,0,0,0,0,160,192,
+    0,0,0,0,0,160,255,255,255,255,255,157,160,200,32,32,32,32,20,160,192,0,0,0,
+    0,0,160,192,0,0,0,0,0,160,204,48,48,48,48,45,160,255,255,255,255,255,242,30,
+    48,48,48,48,48,11,160,251,239,239,239,239,57,160,192,0,0,0,0,0,160,192,0,0,
+    0,0,0,160,196,16,16,16,13,0,160,255,255,255,255,204,0,160,200,32,32,32,26,0,
+    160,192,0,0,0,0,0,160,192,0,0,0,0,0,160,192,0,0,0,0,0,160,192,0,
+    0,0,0,0,0,0,0,6,62,94,91,53,2,0,0,0,80,230,241,197,197,242,225,61,
+    0,67,252,134,7,0,0,7,104,97,0,203,186,0,0,0,0,0,0,0,21,255,98,0,
+    0,0,0,0,0,0,50,255,66,0,0,0,74,80,80,56,47,255,69,0,0,0,191,207,
+    239,179,14,252,110,0,0,0,0,0,170,179,0,182,208,4,0,0,0,0,170,179,0,41,
+    240,179,42,0,0,31,201,179,0,0,43,187,253,245,244,250,178,49,0,0,0,0,15,46,
+    43,10,0,0,30,36,0,0,0,0,11,48,7,160,192,0,0,0,0,58,255,39,160,192,
+    0,0,0,0,58,255,39,160,192,0,0,0,0,58,255,39,160,192,0,0,0,0,58,255,
+    39,160,255,255,255,255,255,255,255,39,160,200,32,32,32,32,83,255,39,160,192,0,0,0,
+    0,58,255,39,160,192,0,0,0,0,58,255,39,160,192,0,0,0,0,58,255,39,160,192,
+    0,0,0,0,58,255,39,30,36,160,192,160,192,160,192,160,192,160,192,160,192,160,192,160,
+    192,160,192,160,192,0,0,30,36,0,0,160,192,0,0,160,192,0,0,160,192,0,0,160,
+    192,0,0,160,192,0,0,160,192,0,0,160,192,0,0,160,192,0,0,160,192,0,0,162,
+    190,0,0,193,166,69,136,254,84,150,189,101,0,30,36,0,0,0,0,37,47,1,160,192,
+    0,0,0,107,250,95,0,160,192,0,0,122,248,82,0,0,160,192,1,137,244,70,0,0,
+    0,160,195,151,239,58,0,0,0,0,160,253,255,79,0,0,0,0,0,160,206,198,222,31,
+    0,0,0,0,160,192,14,199,222,30,0,0,0,160,192,0,14,199,221,30,0,0,160,192,
+    0,0,15,200,221,29,0,160,192,0,0,0,15,200,220,29,30,36,0,0,0,0,0,160,
+    192,0,0,0,0,0,160,192,0,0,0,0,0,160,192,0,0,0,0,0,160,192,0,0,
+    0,0,0,160,192,0,0,0,0,0,160,192,0,0,0,0,0,160,192,0,0,0,0,0,
+    160,192,0,0,0,0,0,160,204,48,48,48,48,35,160,255,255,255,255,255,185,30,48,23,
+    0,0,0,0,19,48,34,160,255,178,0,0,0,0,156,255,182,160,213,248,23,0,0,11,
+    242,211,182,160,182,188,114,0,0,93,208,162,182,160,182,92,209,0,0,189,112,162,182,160,
+    182,10,241,50,32,248,21,162,182,160,182,0,155,146,127,175,0,162,182,160,182,0,59,235,
+    222,79,0,162,182,160,182,0,1,218,233,5,0,162,182,160,182,0,0,10,12,0,0,162,
+    182,160,182,0,0,0,0,0,0,162,182,30,48,14,0,0,0,12,48,5,160,255,155,0,
+    0,0,62,255,25,160,235,251,39,0,0,62,255,25,160,182,188,170,0,0,62,255,25,160,
+    182,53,253,52,0,62,255,25,160,182,0,172,186,0,62,255,25,160,182,0,41,252,66,62,
+    255,25,160,182,0,0,157,200,62,255,25,160,182,0,0,30,247,143,255,25,160,182,0,0,
+    0,142,248,255,25,160,182,0,0,0,20,241,255,25,0,0,0,12,74,96,75,13,0,0,
+    0,0,0,89,238,228,191,225,240,93,0,0,0,68,253,126,2,0,2,119,254,73,0,0,
+    202,189,0,0,0,0,0,183,208,0,21,255,100,0,0,0,0,0,95,255,25,50,255,66,
+    0,0,0,0,0,61,255,55,47,255,70,0,0,0,0,0,65,255,52,14,252,112,0,0,
+    0,0,0,107,253,17,0,183,211,4,0,0,0,3,206,188,0,0,43,242,170,25,0,22,
+    165,244,46,0,0,0,51,201,254,239,254,204,54,0,0,0,0,0,0,25,48,26,0,0,
+    0,0,30,48,48,48,30,0,0,160,251,239,239,255,203,32,160,192,0,0,38,226,181,160,
+    192,0,0,0,135,240,160,192,0,0,0,153,230,160,208,64,64,116,248,143,160,247,223,223,
+    207,125,6,160,192,0,0,0,0,0,160,192,0,0,0,0,0,160,192,0,0,0,0,0,
+    160,192,0,0,0,0,0,0,0,0,12,74,96,75,13,0,0,0,0,0,89,238,228,191,
+    225,240,93,0,0,0,68,253,126,2,0,2,119,254,73,0,0,202,189,0,0,0,0,0,
+    183,208,0,21,255,100,0,0,0,0,0,95,255,25,50,255,66,0,0,0,0,0,61,255,
+    55,47,255,70,0,0,0,0,0,65,255,52,13,252,112,0,0,0,0,0,107,253,17,0,
+    182,211,4,0,0,0,3,206,186,0,0,43,242,170,25,0,22,165,243,45,0,0,0,50,
+    201,254,239,254,214,50,0,0,0,0,0,0,25,48,155,235,40,0,0,0,0,0,0,0,
+    0,3,156,177,11,0,30,48,48,48,33,0,0,0,0,160,251,239,239,255,211,41,0,0,
+    160,192,0,0,31,218,191,0,0,160,192,0,0,0,132,241,0,0,160,192,0,0,0,164,
+    220,0,0,160,220,112,114,163,250,90,0,0,160,235,175,180,238,182,6,0,0,160,192,0,
+    0,26,232,134,0,0,160,192,0,0,0,104,246,26,0,160,192,0,0,0,6,225,145,0,
+    160,192,0,0,0,0,104,247,27,0,0,13,77,96,83,38,0,0,0,67,238,228,191,207,
+    252,119,0,1,226,162,3,0,0,22,45,0,16,255,86,0,0,0,0,0,0,1,229,197,
+    51,2,0,0,0,0,0,63,225,255,242,189,98,2,0,0,0,3,58,112,183,255,151,0,
+    0,0,0,0,0,0,140,251,11,0,0,0,0,0,0,94,255,21,8,153,52,2,0,35,
+    205,211,0,5,186,248,247,241,255,197,39,0,0,0,6,41,48,21,0,0,0,2,48,48,
+    48,48,48,48,48,48,28,10,239,239,239,246,255,239,239,239,142,0,0,0,0,107,247,0,
+    0,0,0,0,0,0,0,107,247,0,0,0,0,0,0,0,0,107,247,0,0,0,0,0,
+    0,0,0,107,247,0,0,0,0,0,0,0,0,107,247,0,0,0,0,0,0,0,0,107,
+    247,0,0,0,0,0,0,0,0,107,247,0,0,0,0,0,0,0,0,107,247,0,0,0,
+    0,0,0,0,0,107,247,0,0,0,0,37,29,0,0,0,0,17,48,1,200,154,0,0,
+    0,0,91,255,8,200,154,0,0,0,0,91,255,8,200,154,0,0,0,0,91,255,8,200,
+    154,0,0,0,0,91,255,8,200,154,0,0,0,0,91,255,8,200,154,0,0,0,0,91,
+    255,8,196,160,0,0,0,0,97,254,4,163,203,0,0,0,0,140,226,0,68,254,105,3,
+    0,61,239,131,0,0,105,238,247,243,249,151,6,0,0,0,4,41,45,12,0,0,0,41,
+    28,0,0,0,0,0,1,48,20,158,208,0,0,0,0,0,61,255,49,61,255,49,0,0,
+    0,0,158,207,0,1,218,145,0,0,0,11,242,110,0,0,121,235,6,0,0,95,248,19,
+    0,0,27,252,82,0,0,191,170,0,0,0,0,182,178,0,33,254,73,0,0,0,0,84,
+    251,23,128,228,3,0,0,0,0,6,235,117,223,134,0,0,0,0,0,0,145,241,254,37,
+    0,0,0,0,0,0,47,255,194,0,0,0,0,24,42,0,0,0,0,42,35,0,0,0,
+    2,48,17,91,251,13,0,0,12,250,223,0,0,0,49,255,53,28,255,72,0,0,71,219,
+    245,31,0,0,112,240,3,0,219,136,0,0,134,153,188,94,0,0,175,180,0,0,155,199,
+    0,0,197,90,126,158,0,2,237,116,0,0,91,250,12,11,250,27,64,221,0,47,255,52,
+    0,0,27,255,71,69,220,0,9,248,30,110,240,3,0,0,0,218,135,132,157,0,0,195,
+    93,173,179,0,0,0,0,154,198,195,95,0,0,133,158,235,115,0,0,0,0,90,250,249,
+    32,0,0,71,244,255,51,0,0,0,0,27,255,225,0,0,0,13,251,239,3,0,0,2,
+    48,21,0,0,0,0,30,41,0,0,165,208,6,0,0,24,237,118,0,0,19,231,129,0,
+    0,177,199,3,0,0,0,79,250,49,94,246,40,0,0,0,0,0,164,213,238,116,0,0,
+    0,0,0,0,29,254,213,3,0,0,0,0,0,0,146,236,251,51,0,0,0,0,0,63,
+    252,63,164,209,6,0,0,0,11,221,146,0,19,232,128,0,0,0,148,220,11,0,0,82,
+    250,47,0,65,252,63,0,0,0,0,169,205,5,0,45,25,0,0,0,0,0,46,24,0,
+    140,224,14,0,0,0,96,245,36,0,9,215,155,0,0,28,239,109,0,0,0,55,251,72,
+    0,182,190,2,0,0,0,0,134,227,114,242,32,0,0,0,0,0,7,210,255,102,0,0,
+    0,0,0,0,0,108,248,1,0,0,0,0,0,0,0,107,247,0,0,0,0,0,0,0,
+    0,107,247,0,0,0,0,0,0,0,0,107,247,0,0,0,0,0,0,0,0,107,247,0,
+    0,0,0,10,48,48,48,48,48,48,48,38,51,239,239,239,239,239,239,254,203,0,0,0,
+    0,0,0,91,252,73,0,0,0,0,0,51,246,120,0,0,0,0,0,22,226,168,1,0,
+    0,0,0,5,194,207,11,0,0,0,0,0,150,235,32,0,0,0,0,0,101,251,65,0,
+    0,0,0,0,58,249,110,0,0,0,0,0,27,231,193,48,48,48,48,48,46,95,255,255,
+    255,255,255,255,255,245,127,159,159,16,203,160,80,8,203,118,0,0,203,118,0,0,203,118,
+    0,0,203,118,0,0,203,118,0,0,203,118,0,0,203,118,0,0,203,118,0,0,203,118,
+    0,0,203,135,32,3,178,223,223,23,46,9,0,0,0,199,97,0,0,0,121,176,0,0,
+    0,42,245,10,0,0,0,218,78,0,0,0,139,157,0,0,0,60,233,3,0,0,3,234,
+    60,0,0,0,158,138,0,0,0,79,217,0,0,0,10,245,41,0,0,0,176,120,0,0,
+    0,39,54,102,159,159,41,51,81,255,66,0,1,255,66,0,1,255,66,0,1,255,66,0,
+    1,255,66,0,1,255,66,0,1,255,66,0,1,255,66,0,1,255,66,0,1,255,66,20,
+    33,255,66,143,223,223,58,0,0,0,0,44,31,0,0,0,0,0,0,0,126,252,246,66,
+    0,0,0,0,0,119,240,65,120,243,61,0,0,0,113,229,47,0,0,95,237,57,0,38,
+    156,32,0,0,0,0,72,144,9,24,175,175,175,175,175,175,175,24,11,80,80,80,80,80,
+    80,80,11,36,28,0,0,65,229,29,0,0,92,196,5,0,0,73,29,0,63,165,204,204,
+    151,24,0,0,108,107,66,75,188,206,1,0,0,0,0,0,15,252,49,0,25,145,200,207,
+    207,253,77,2,213,174,64,39,32,246,78,34,255,33,0,0,29,255,78,17,251,98,0,10,
+    175,253,78,0,117,251,227,237,119,242,78,0,0,20,48,15,0,0,0,116,85,0,0,0,
+    0,0,0,186,137,0,0,0,0,0,0,186,137,0,0,0,0,0,0,186,138,117,201,198,
+    100,0,0,186,233,161,62,105,246,101,0,186,214,2,0,0,127,223,0,186,149,0,0,0,
+    60,255,20,186,141,0,0,0,51,255,27,186,183,0,0,0,93,244,4,186,251,73,0,22,
+    214,155,0,186,160,207,226,247,191,16,0,0,0,1,39,36,0,0,0,0,0,76,180,207,
+    194,111,0,102,248,124,65,82,130,6,237,119,0,0,0,0,46,255,40,0,0,0,0,53,
+    255,30,0,0,0,0,18,252,79,0,0,0,0,0,164,216,35,0,3,55,0,13,169,251,
+    226,242,184,0,0,0,19,48,29,0,0,0,0,0,0,0,102,98,0,0,0,0,0,0,
+    164,157,0,0,0,0,0,0,164,157,0,2,117,202,198,100,164,157,0,128,236,93,64,180,
+    233,157,8,243,98,0,0,10,235,157,47,255,31,0,0,0,176,157,54,255,22,0,0,0,
+    168,157,21,254,64,0,0,0,210,157,0,182,194,13,0,98,253,157,0,27,207,243,230,191,
+    176,157,0,0,1,39,35,0,0,0,0,0,77,182,207,181,64,0,0,98,242,111,64,120,
+    246,59,4,234,101,0,0,0,150,174,44,255,148,128,128,128,179,216,54,255,142,128,128,128,
+    128,111,19,252,76,0,0,0,0,0,0,162,216,38,0,0,34,64,0,10,159,250,227,233,
+    243,106,0,0,0,14,46,39,4,0,0,0,75,153,159,31,0,57,250,127,112,22,0,116,
+    206,0,0,0,119,213,238,175,151,0,54,163,218,80,69,0,0,121,201,0,0,0,0,121,
+    201,0,0,0,0,121,201,0,0,0,0,121,201,0,0,0,0,121,201,0,0,0,0,121,
+    201,0,0,0,0,3,122,202,198,100,113,108,0,137,233,90,63,174,233,157,10,246,91,0,
+    0,7,230,157,49,255,28,0,0,0,174,157,53,255,24,0,0,0,170,157,16,251,75,0,
+    0,1,219,157,0,163,215,49,23,138,245,157,0,12,163,245,240,140,170,152,0,0,0,0,
+    0,1,215,115,0,49,95,38,47,155,242,27,0,44,188,226,227,180,52,0,116,85,0,0,
+    0,0,0,186,137,0,0,0,0,0,186,137,0,0,0,0,0,186,137,105,199,201,110,0,
+    186,228,159,70,113,251,80,186,197,0,0,0,176,156,186,140,0,0,0,147,174,186,137,0,
+    0,0,146,174,186,137,0,0,0,146,174,186,137,0,0,0,146,174,186,137,0,0,0,146,
+    174,108,92,163,138,0,0,119,101,174,147,174,147,174,147,174,147,174,147,174,147,174,147,0,
+    0,108,92,0,0,163,138,0,0,0,0,0,0,119,101,0,0,174,147,0,0,174,147,0,
+    0,174,147,0,0,174,147,0,0,174,147,0,0,174,147,0,0,174,147,0,0,178,143,8,
+    57,231,100,60,228,159,7,116,85,0,0,0,0,0,0,186,137,0,0,0,0,0,0,186,
+    137,0,0,0,0,0,0,186,137,0,0,23,164,95,0,186,137,0,39,222,147,3,0,186,
+    137,60,235,116,0,0,0,186,203,241,88,0,0,0,0,186,194,243,111,0,0,0,0,186,
+    137,59,240,120,0,0,0,186,137,0,53,237,130,0,0,186,137,0,0,46,233,139,1,108,
+    92,174,147,174,147,174,147,174,147,174,147,174,147,174,147,174,147,174,147,174,147,128,95,111,
+    200,197,82,2,119,201,196,76,0,186,230,154,68,136,251,164,146,68,144,248,28,186,195,0,
+    0,0,223,184,0,0,2,233,96,186,140,0,0,0,198,129,0,0,0,209,114,186,137,0,
+    0,0,197,126,0,0,0,208,114,186,137,0,0,0,197,126,0,0,0,208,114,186,137,0,
+    0,0,197,126,0,0,0,208,114,186,137,0,0,0,197,126,0,0,0,208,114,128,94,105,
+    199,201,110,0,186,228,159,70,113,251,80,186,197,0,0,0,176,156,186,140,0,0,0,147,
+    174,186,137,0,0,0,146,174,186,137,0,0,0,146,174,186,137,0,0,0,146,174,186,137,
+    0,0,0,146,174,0,1,101,193,207,165,41,0,0,123,242,102,67,169,238,30,8,242,109,
+    0,0,4,217,141,47,255,38,0,0,0,149,193,54,255,30,0,0,0,141,200,21,254,73,
+    0,0,0,185,166,0,180,203,19,0,81,253,70,0,23,192,247,229,245,114,0,0,0,0,
+    30,46,11,0,0,128,95,117,201,198,100,0,0,186,233,161,62,105,246,101,0,186,214,2,
+    0,0,127,223,0,186,149,0,0,0,60,255,20,186,141,0,0,0,51,255,27,186,183,0,
+    0,0,93,244,4,186,251,73,0,22,214,155,0,186,160,207,226,247,191,16,0,186,137,1,
+    39,36,0,0,0,186,137,0,0,0,0,0,0,174,128,0,0,0,0,0,0,0,2,117,
+    202,198,100,113,108,0,128,236,93,64,180,233,157,8,243,98,0,0,10,235,157,47,255,31,
+    0,0,0,176,157,54,255,22,0,0,0,168,157,21,254,64,0,0,0,210,157,0,182,194,
+    13,0,98,253,157,0,27,207,243,230,191,176,157,0,0,1,39,35,0,164,157,0,0,0,
+    0,0,0,164,157,0,0,0,0,0,0,154,147,128,95,111,199,155,186,231,167,81,72,186,
+    207,1,0,0,186,145,0,0,0,186,137,0,0,0,186,137,0,0,0,186,137,0,0,0,
+    186,137,0,0,0,0,51,172,207,203,164,24,12,239,144,60,65,121,36,43,255,23,0,0,
+    0,0,6,216,221,136,74,7,0,0,15,108,173,239,227,40,0,0,0,0,10,210,144,32,
+    64,2,0,15,215,129,47,236,242,223,246,184,16,0,1,33,48,24,0,0,0,145,117,0,
+    0,0,0,179,144,0,0,0,109,231,220,175,175,27,50,203,178,80,80,12,0,179,144,0,
+    0,0,0,179,144,0,0,0,0,179,144,0,0,0,0,178,145,0,0,0,0,151,194,23,
+    16,2,0,39,205,251,255,39,142,78,0,0,0,115,105,207,114,0,0,0,167,153,207,114,
+    0,0,0,167,153,207,114,0,0,0,167,153,207,114,0,0,0,168,153,199,126,0,0,0,
+    196,153,148,211,15,0,92,251,153,27,216,247,236,176,175,153,0,3,42,32,0,0,0,82,
+    152,0,0,0,0,102,132,39,255,46,0,0,2,226,111,0,197,141,0,0,68,249,21,0,
+    102,232,4,0,163,175,0,0,15,246,76,13,245,79,0,0,0,166,171,98,233,5,0,0,
+    0,70,248,206,143,0,0,0,0,3,227,255,47,0,0,58,163,0,0,17,175,96,0,0,
+    84,137,28,255,38,0,81,250,197,0,0,178,143,0,216,105,0,148,153,248,13,4,241,76,
+    0,150,172,0,215,66,205,76,57,251,14,0,83,237,30,246,8,138,143,124,198,0,0,18,
+    253,145,187,0,71,210,190,131,0,0,0,204,248,120,0,11,248,249,64,0,0,0,138,255,
+    53,0,0,193,245,7,0,23,172,65,0,0,14,167,79,0,123,231,24,0,168,204,7,0,
+    2,186,188,105,241,35,0,0,0,23,230,254,86,0,0,0,0,23,231,253,63,0,0,0,
+    2,187,186,132,228,20,0,0,123,231,23,3,192,181,1,61,249,68,0,0,27,235,116,80,
+    153,0,0,0,0,103,130,30,252,54,0,0,5,231,103,0,178,156,0,0,83,242,13,0,
+    73,244,14,0,185,153,0,0,2,221,105,34,253,50,0,0,0,118,207,134,203,0,0,0,
+    0,21,248,244,100,0,0,0,0,0,165,241,12,0,0,0,0,0,187,150,0,0,0,0,
+    28,92,251,42,0,0,0,0,213,223,105,0,0,0,0,40,175,175,175,175,175,131,22,96,
+    96,96,103,241,162,0,0,0,1,167,210,14,0,0,0,132,230,30,0,0,0,97,244,52,
+    0,0,0,66,247,79,0,0,0,39,239,113,0,0,0,0,102,255,255,255,255,255,191,0,
+    0,0,44,137,159,25,0,0,2,231,171,88,13,0,0,27,255,43,0,0,0,0,32,255,
+    36,0,0,0,0,33,255,35,0,0,0,0,72,253,16,0,0,44,180,237,118,0,0,0,
+    20,84,186,199,1,0,0,0,0,47,255,27,0,0,0,0,32,255,36,0,0,0,0,31,
+    255,36,0,0,0,0,18,255,59,0,0,0,0,0,183,233,180,28,0,0,0,2,47,70,
+    13,39,165,57,240,57,240,57,240,57,240,57,240,57,240,57,240,57,240,57,240,57,240,57,
+    240,57,240,57,240,18,75,40,159,132,34,0,0,0,20,90,184,209,0,0,0,0,0,66,
+    254,3,0,0,0,0,60,255,6,0,0,0,0,59,255,7,0,0,0,0,37,255,47,0,
+    0,0,0,0,139,234,178,28,0,0,7,216,170,83,13,0,0,51,255,21,0,0,0,0,
+    60,255,6,0,0,0,0,60,255,6,0,0,0,0,82,247,1,0,0,44,181,238,159,0,
+    0,0,20,68,43,0,0,0,0,0,20,92,98,35,0,0,0,27,31,78,238,194,202,251,
+    197,135,153,235,45,79,33,0,0,25,112,157,133,36,0,
+};
+
+inline constexpr FontData c_FontText{ 14.0f, 12.9951f, 16.2969f, 32, 95, c_FontTextGlyphs, c_FontTextCoverage };
+
+inline constexpr GlyphInfo c_FontHintGlyphs[] = {
+    { 0, 0, 0, 0, 0, 244 }, // ' '
+    { 0, 2, 9, 1, 9, 308 }, // '!'
+    { 18, 4, 4, 1, 9, 353 }, // '"'
+    { 34, 10, 9, 0, 9, 644 }, // '#'
+    { 124, 7, 12, 0, 10, 489 }, // '$'
+    { 208, 11, 10, 0, 9, 730 }, // '%'
+    { 318, 9, 10, 0, 9, 599 }, // '&'
+    { 408, 2, 4, 1, 9, 211 }, // "'"
+    { 416, 3, 12, 1, 10, 300 }, // '('
+    { 452, 4, 12, 0, 10, 300 }, // ')'
+    { 500, 6, 6, 0, 9, 384 }, // '*'
+    { 536, 8, 8, 1, 8, 644 }, // '+'
+    { 600, 3, 4, 0, 2, 244 }, // ','
+    { 612, 4, 2, 0, 4, 277 }, // '-'
+    { 620, 2, 2, 1, 2, 244 }, // '.'
+    { 624, 5, 11, 0, 9, 259 }, // '/'
+    { 679, 7, 10, 0, 9, 489 }, // '0'
+    { 749, 6, 9, 1, 9, 489 }, // '1'
+    { 803, 7, 9, 0, 9, 489 }, // '2'
+    { 866, 7, 10, 0, 9, 489 }, // '3'
+    { 936, 7, 9, 0, 9, 489 }, // '4'
+    { 999, 7, 10, 0, 9, 489 }, // '5'
+    { 1069, 7, 10, 0, 9, 489 }, // '6'
+    { 1139, 7, 9, 0, 9, 489 }, // '7'
+    { 1202, 7, 10, 0, 9, 489 }, // '8'
+    { 1272, 7, 10, 0, 9, 489 }, // '9'
+    { 1342, 2, 7, 1, 7, 259 }, // ':'
+    { 1356, 3, 9, 0, 7, 259 }, // ';'
+    { 1383, 8, 7, 1, 7, 644 }, // '<'
+    { 1439, 8, 4, 1, 6, 644 }, // '='
+    { 1471, 8, 7, 1, 7, 644 }, // '>'
+    { 1527, 6, 9, 0, 9, 408 }, // '?'
+    { 1581, 12, 12, 0, 9, 768 }, // '@'
+    { 1725, 9, 9, 0, 9, 525 }, // 'A'
+    { 1806, 7, 9, 1, 9, 527 }, // 'B'
+    { 1869, 8, 10, 0, 9, 536 }, // 'C'
+    { 1949, 8, 9, 1, 9, 591 }, // 'D'
+    { 2021, 6, 9, 1, 9, 485 }, // 'E'
+    { 2075, 6, 9, 1, 9, 442 }, // 'F'
+    { 2129, 9, 10, 0, 9, 595 }, // 'G'
+    { 2219, 7, 9, 1, 9, 578 }, // 'H'
+    { 2282, 2, 9, 1, 9, 226 }, // 'I'
+    { 2300, 4, 12, -1, 9, 226 }, // 'J'
+    { 2348, 8, 9, 1, 9, 504 }, // 'K'
+    { 2420, 6, 9, 1, 9, 428 }, // 'L'
+    { 2474, 9, 9, 1, 9, 663 }, // 'M'
+    { 2555, 7, 9, 1, 9, 574 }, // 'N'
+    { 2618, 9, 10, 0, 9, 604 }, // 'O'
+    { 2708, 6, 9, 1, 9, 463 }, // 'P'
+    { 2762, 9, 11, 0, 9, 604 }, // 'Q'
+    { 2861, 7, 9, 1, 9, 534 }, // 'R'
+    { 2924, 7, 10, 0, 9, 488 }, // 'S'
+    { 2994, 9, 9, -1, 9, 469 }, // 'T'
+    { 3075, 7, 10, 1, 9, 562 }, // 'U'
+    { 3145, 9, 9, 0, 9, 525 }, // 'V'
+    { 3226, 12, 9, 0, 9, 759 }, // 'W'
+    { 3334, 8, 9, 0, 9, 526 }, // 'X'
+    { 3406, 9, 9, -1, 9, 469 }, // 'Y'
+    { 3487, 8, 9, 0, 9, 526 }, // 'Z'
+    { 3559, 3, 12, 1, 10, 300 }, // '['
+    { 3595, 5, 11, 0, 9, 259 }, // '\\'
+    { 3650, 3, 12, 1, 10, 300 }, // ']'
+    { 3686, 8, 4, 1, 9, 644 }, // '^'
+    { 3718, 8, 2, -1, -1, 384 }, // '_'
+    { 3734, 4, 3, 0, 10, 384 }, // '`'
+    { 3746, 7, 8, 0, 7, 471 }, // 'a'
+    { 3802, 6, 11, 1, 10, 488 }, // 'b'
+    { 3868, 6, 8, 0, 7, 422 }, // 'c'
+    { 3916, 7, 11, 0, 10, 488 }, // 'd'
+    { 3993, 7, 8, 0, 7, 472 }, // 'e'
+    { 4049, 5, 10, 0, 10, 270 }, // 'f'
+    { 4099, 7, 10, 0, 7, 488 }, // 'g'
+    { 4169, 6, 10, 1, 10, 487 }, // 'h'
+    { 4229, 2, 10, 1, 10, 213 }, // 'i'
+    { 4249, 4, 13, -1, 10, 213 }, // 'j'
+    { 4301, 6, 10, 1, 10, 445 }, // 'k'
+    { 4361, 2, 10, 1, 10, 213 }, // 'l'
+    { 4381, 10, 7, 1, 7, 748 }, // 'm'
+    { 4451, 6, 7, 1, 7, 487 }, // 'n'
+    { 4493, 7, 8, 0, 7, 470 }, // 'o'
+    { 4549, 6, 10, 1, 7, 488 }, // 'p'
+    { 4609, 7, 10, 0, 7, 488 }, // 'q'
+    { 4679, 4, 7, 1, 7, 316 }, // 'r'
+    { 4707, 6, 8, 0, 7, 400 }, // 's'
+    { 4755, 5, 9, 0, 9, 301 }, // 't'
+    { 4800, 6, 8, 1, 7, 487 }, // 'u'
+    { 4848, 7, 7, 0, 7, 454 }, // 'v'
+    { 4897, 10, 7, 0, 7, 628 }, // 'w'
+    { 4967, 7, 7, 0, 7, 454 }, // 'x'
+    { 5016, 7, 10, 0, 7, 454 }, // 'y'
+    { 5086, 6, 7, 0, 7, 403 }, // 'z'
+    { 5128, 6, 12, 1, 10, 489 }, // '{'
+    { 5200, 2, 13, 1, 10, 259 }, // '|'
+    { 5226, 6, 12, 1, 10, 489 }, // '}'
+    { 5298, 8, 3, 1, 5, 644 }, // '~'
+};
+
+inline constexpr uint8_t c_FontHintCoverage[] = {
+    36,191,48,255,48,255,48,255,42,249,27,235,3,42,24,128,48,255,162,29,121,70,216,38,
+    161,93,216,38,161,93,108,19,80,47,0,0,0,0,122,29,16,133,0,0,0,0,0,4,
+    231,5,79,162,0,0,0,19,48,87,203,48,159,133,48,6,0,78,191,227,216,191,249,194,
+    191,26,0,0,0,182,60,17,224,0,0,0,6,80,80,240,86,126,199,80,37,0,11,143,
+    175,217,143,213,179,143,66,0,0,0,118,122,0,205,35,0,0,0,0,0,182,59,16,223,
+    0,0,0,0,0,0,0,17,2,0,0,0,0,0,135,14,0,0,0,24,141,221,188,142,
+    11,0,202,127,151,49,97,16,0,250,33,135,14,0,0,0,159,215,202,88,13,0,0,1,
+    64,190,192,235,51,0,0,0,135,14,142,154,1,82,3,135,19,173,128,0,165,215,236,223,
+    157,11,0,0,0,137,14,0,0,0,0,0,102,10,0,0,0,125,194,180,20,0,0,71,
+    154,0,0,47,202,2,113,140,0,7,205,27,0,0,83,155,0,62,177,0,123,116,0,0,
+    0,43,206,4,119,136,32,202,5,0,0,0,0,114,196,169,17,175,64,51,140,108,3,0,
+    0,0,0,74,165,18,221,58,157,116,0,0,0,8,206,25,71,168,0,57,183,0,0,0,
+    127,112,0,56,188,0,77,167,0,0,34,201,4,0,2,183,165,211,55,0,0,22,23,0,
+    0,0,1,38,13,0,0,0,95,211,221,175,10,0,0,0,32,246,59,11,80,12,0,0,
+    0,50,237,6,0,0,0,0,0,0,2,224,157,1,0,0,0,0,0,142,179,207,149,1,
+    0,96,93,29,246,18,20,211,143,0,186,81,57,236,0,0,23,214,164,216,5,11,236,105,
+    0,0,71,255,156,0,0,61,223,220,211,217,93,221,127,0,0,2,36,33,1,0,0,0,
+    162,29,216,38,216,38,108,19,0,8,22,0,148,100,29,226,6,126,147,0,197,86,0,237,
+    53,0,244,47,0,220,67,0,163,116,0,76,192,0,2,210,42,0,58,79,1,29,0,0,
+    0,182,66,0,0,64,197,0,0,1,228,44,0,0,168,116,0,0,134,156,0,0,128,163,
+    0,0,149,138,0,0,197,82,0,22,236,10,0,122,132,0,0,123,14,0,0,0,80,80,
+    0,0,91,103,87,87,103,91,0,79,208,208,79,0,33,153,179,179,153,33,58,28,85,85,
+    28,58,0,0,48,48,0,0,0,0,0,59,66,0,0,0,0,0,0,119,132,0,0,0,
+    0,0,0,119,132,0,0,0,46,64,64,153,163,64,64,50,139,191,191,221,224,191,191,150,
+    0,0,0,119,132,0,0,0,0,0,0,119,132,0,0,0,0,0,0,119,132,0,0,0,
+    0,76,82,0,159,149,0,212,39,2,75,0,79,191,191,142,20,48,48,36,91,66,183,132,
+    0,0,14,176,1,0,0,86,168,0,0,0,165,89,0,0,5,233,16,0,0,68,186,0,
+    0,0,147,107,0,0,1,224,29,0,0,49,205,0,0,0,128,126,0,0,0,207,47,0,
+    0,0,31,0,0,0,0,0,8,147,220,207,85,0,0,142,190,26,60,240,51,4,241,60,
+    0,0,153,150,37,255,11,0,0,104,197,52,251,0,0,0,89,212,43,254,5,0,0,97,
+    204,11,250,42,0,0,135,166,0,177,146,0,15,224,83,0,31,213,210,232,149,1,0,0,
+    2,37,21,0,0,68,144,187,114,0,0,119,132,187,151,0,0,0,0,147,151,0,0,0,
+    0,147,151,0,0,0,0,147,151,0,0,0,0,147,151,0,0,0,0,147,151,0,0,0,
+    0,147,151,0,0,130,255,255,255,255,134,5,135,204,223,194,69,0,14,150,57,28,107,249,
+    37,0,0,0,0,0,213,94,0,0,0,0,20,244,53,0,0,0,4,182,161,0,0,0,
+    3,166,183,7,0,0,3,163,188,9,0,0,2,159,192,11,0,0,0,31,255,255,255,255,
+    255,111,0,134,209,223,205,100,0,0,84,47,27,78,243,70,0,0,0,0,0,188,114,0,
+    0,27,48,92,228,36,0,0,119,208,242,142,3,0,0,0,0,15,206,116,0,0,0,0,
+    0,134,168,8,36,0,0,22,212,120,16,232,225,213,245,160,8,0,1,29,43,12,0,0,
+    0,0,0,14,181,136,0,0,0,0,152,213,182,0,0,0,65,191,120,182,0,0,11,212,
+    38,119,182,0,0,144,122,0,119,182,0,55,214,21,16,127,186,15,99,239,239,239,246,250,
+    230,0,0,0,0,119,182,0,0,0,0,0,119,182,0,0,135,191,191,191,180,0,0,180,
+    136,64,64,60,0,0,180,97,0,0,0,0,0,180,206,194,162,47,0,0,91,73,60,142,
+    244,37,0,0,0,0,0,186,130,0,0,0,0,0,162,143,7,36,0,0,45,239,82,15,
+    239,224,216,245,132,1,0,2,31,42,9,0,0,0,0,76,196,223,200,48,0,74,233,78,
+    28,60,36,0,207,98,0,0,0,0,18,255,91,180,188,108,1,39,255,206,61,67,223,114,
+    31,255,83,0,0,103,207,4,244,66,0,0,86,218,0,161,154,0,2,173,159,0,21,199,
+    215,220,198,22,0,0,0,33,31,0,0,3,191,191,191,191,191,114,1,64,64,64,67,244,
+    82,0,0,0,0,76,233,6,0,0,0,0,174,141,0,0,0,0,22,250,43,0,0,0,
+    0,116,199,0,0,0,0,0,214,101,0,0,0,0,57,244,14,0,0,0,0,156,160,0,
+    0,0,0,34,174,222,214,131,4,0,203,153,21,41,221,109,0,244,56,0,0,149,150,0,
+    156,163,30,56,221,66,0,39,222,228,239,160,6,7,228,94,0,7,181,141,43,255,6,0,
+    0,99,204,15,247,78,0,2,170,167,0,95,239,203,224,208,33,0,0,6,41,30,0,0,
+    0,34,175,223,200,71,0,3,216,139,19,68,239,38,49,250,8,0,0,170,136,54,249,3,
+    0,0,163,184,8,234,107,0,36,237,200,0,61,215,233,215,165,187,0,0,0,4,0,167,
+    136,0,21,0,0,69,240,33,0,161,227,219,229,71,0,0,0,29,38,3,0,0,28,31,
+    151,164,47,51,0,0,0,0,76,82,151,164,0,28,31,0,151,164,0,47,51,0,0,0,
+    0,0,0,0,76,82,0,159,149,0,212,39,2,75,0,0,0,0,0,0,37,129,166,0,
+    0,20,107,199,228,140,47,71,177,235,157,67,2,0,0,159,249,132,34,0,0,0,0,0,
+    43,136,226,199,108,22,0,0,0,0,2,66,158,237,151,0,0,0,0,0,0,9,61,81,
+    112,112,112,112,112,112,87,104,143,143,143,143,143,143,112,12,16,16,16,16,16,16,12,174,
+    239,239,239,239,239,239,187,156,135,42,0,0,0,0,0,42,136,225,204,112,23,0,0,0,
+    0,2,62,153,234,182,78,0,0,0,0,31,126,247,173,0,19,104,194,229,141,48,0,139,
+    238,164,71,3,0,0,0,59,12,0,0,0,0,0,0,10,143,215,220,145,5,29,122,30,
+    42,225,104,0,0,0,0,187,121,0,0,0,109,222,21,0,0,83,224,30,0,0,0,167,
+    121,0,0,0,0,107,71,0,0,0,0,90,61,0,0,0,0,181,123,0,0,0,0,0,
+    0,50,103,109,71,6,0,0,0,0,0,37,195,177,114,103,151,213,72,0,0,0,30,212,
+    57,0,0,0,0,25,201,65,0,0,171,71,0,86,189,171,100,87,31,203,0,14,205,0,
+    46,220,44,42,217,127,0,192,26,49,163,0,113,129,0,0,120,127,0,180,35,41,172,0,
+    103,144,0,0,135,127,13,212,3,4,216,7,22,224,119,116,225,180,191,77,0,0,129,130,
+    0,30,116,96,51,105,28,0,0,0,6,181,139,15,0,0,10,117,38,0,0,0,0,4,
+    112,209,202,198,214,126,9,0,0,0,0,0,0,0,11,13,0,0,0,0,0,0,0,0,
+    136,174,1,0,0,0,0,0,18,243,228,64,0,0,0,0,0,108,179,127,161,0,0,0,
+    0,0,206,85,34,243,14,0,0,0,48,238,8,0,193,101,0,0,0,145,187,64,64,147,
+    198,0,0,7,236,197,191,191,191,247,40,0,85,222,1,0,0,0,167,137,0,182,132,0,
+    0,0,0,76,230,4,157,191,191,188,143,26,0,210,133,64,68,174,205,0,210,92,0,0,
+    50,254,2,210,112,32,42,157,186,0,210,224,207,212,237,79,0,210,92,0,0,42,246,40,
+    210,92,0,0,0,225,94,210,92,0,1,77,253,50,210,255,255,254,219,99,0,0,0,63,
+    178,221,220,169,54,0,85,241,104,27,27,96,159,5,232,100,0,0,0,0,4,56,253,11,
+    0,0,0,0,0,81,237,0,0,0,0,0,0,67,249,4,0,0,0,0,0,16,247,67,
+    0,0,0,0,0,0,134,217,38,0,0,31,114,0,2,128,239,216,215,230,101,0,0,0,
+    4,38,35,2,0,157,191,191,181,141,55,0,0,210,133,64,69,126,239,127,0,210,92,0,
+    0,0,58,253,40,210,92,0,0,0,0,213,111,210,92,0,0,0,0,185,133,210,92,0,
+    0,0,0,201,120,210,92,0,0,0,28,250,62,210,92,0,5,62,207,180,1,210,255,255,
+    245,204,118,7,0,157,191,191,191,191,136,210,133,64,64,64,45,210,92,0,0,0,0,210,
+    123,48,48,48,25,210,224,207,207,207,109,210,92,0,0,0,0,210,92,0,0,0,0,210,
+    92,0,0,0,0,210,255,255,255,255,208,157,191,191,191,191,39,210,133,64,64,64,13,210,
+    92,0,0,0,0,210,123,48,48,40,0,210,224,207,207,172,0,210,92,0,0,0,0,210,
+    92,0,0,0,0,210,92,0,0,0,0,210,92,0,0,0,0,0,0,61,176,220,222,186,
+    97,2,0,85,241,106,30,22,75,194,22,6,232,97,0,0,0,0,2,3,57,253,11,0,
+    0,0,0,0,0,81,237,0,0,0,113,143,143,45,67,249,3,0,0,76,96,232,80,16,
+    248,65,0,0,0,0,219,80,0,135,216,40,0,0,8,226,80,0,2,126,238,218,209,235,
+    165,23,0,0,0,4,36,39,7,0,0,157,69,0,0,0,65,162,210,92,0,0,0,86,
+    216,210,92,0,0,0,86,216,210,123,48,48,48,118,216,210,224,207,207,207,223,216,210,92,
+    0,0,0,86,216,210,92,0,0,0,86,216,210,92,0,0,0,86,216,210,92,0,0,0,
+    86,216,157,69,210,92,210,92,210,92,210,92,210,92,210,92,210,92,210,92,0,0,157,69,
+    0,0,210,92,0,0,210,92,0,0,210,92,0,0,210,92,0,0,210,92,0,0,210,92,
+    0,0,210,92,0,0,211,91,0,6,239,65,99,199,213,6,59,84,12,0,157,69,0,0,
+    31,181,79,0,210,92,0,39,226,123,0,0,210,92,48,231,108,0,0,0,210,149,235,94,
+    0,0,0,0,210,249,189,2,0,0,0,0,210,115,213,160,2,0,0,0,210,92,24,214,
+    159,2,0,0,210,92,0,24,214,158,2,0,210,92,0,0,24,215,157,2,157,69,0,0,
+    0,0,210,92,0,0,0,0,210,92,0,0,0,0,210,92,0,0,0,0,210,92,0,0,
+    0,0,210,92,0,0,0,0,210,92,0,0,0,0,210,92,0,0,0,0,210,255,255,255,
+    255,158,157,190,17,0,0,0,138,191,35,210,233,104,0,0,20,231,250,46,210,142,200,0,
+    0,110,149,248,46,210,84,217,41,0,206,53,248,46,210,83,122,136,47,212,0,248,46,210,
+    83,28,226,146,116,0,248,46,210,83,0,185,247,24,0,248,46,210,83,0,38,66,0,0,
+    248,46,210,83,0,0,0,0,0,248,46,157,179,7,0,0,67,153,210,248,110,0,0,89,
+    204,210,145,233,13,0,89,204,210,83,181,126,0,89,204,210,83,48,239,20,89,204,210,83,
+    0,166,141,89,204,210,83,0,36,242,118,204,210,83,0,0,150,233,204,210,83,0,0,25,
+    245,204,0,0,71,186,223,212,134,12,0,0,88,241,92,20,44,185,196,5,6,233,100,0,
+    0,0,11,230,97,57,253,12,0,0,0,0,151,170,81,238,0,0,0,0,0,124,194,67,
+    249,4,0,0,0,0,139,181,16,248,67,0,0,0,1,208,122,0,138,215,30,0,2,128,
+    232,20,0,3,137,240,210,230,202,43,0,0,0,0,9,41,24,0,0,0,157,191,191,179,
+    108,3,210,133,64,85,229,127,210,92,0,0,121,203,210,92,0,0,139,193,210,174,128,152,
+    247,85,210,174,128,112,44,0,210,92,0,0,0,0,210,92,0,0,0,0,210,92,0,0,
+    0,0,0,0,71,186,223,212,134,12,0,0,88,241,92,20,44,185,196,5,6,233,100,0,
+    0,0,11,230,97,57,253,12,0,0,0,0,151,170,81,238,0,0,0,0,0,124,194,67,
+    249,4,0,0,0,0,139,181,16,248,67,0,0,0,1,208,122,0,137,215,30,0,2,128,
+    231,19,0,3,137,240,210,230,208,41,0,0,0,0,9,41,121,224,28,0,0,0,0,0,
+    0,0,105,101,0,157,191,191,180,115,5,0,210,133,64,82,223,137,0,210,92,0,0,117,
+    205,0,210,92,0,0,152,183,0,210,204,175,195,217,45,0,210,143,80,124,232,39,0,210,
+    92,0,0,138,187,0,210,92,0,0,20,242,61,210,92,0,0,0,135,189,0,45,178,222,
+    220,182,57,9,233,127,25,24,83,64,49,253,4,0,0,0,0,17,244,145,47,4,0,0,
+    0,63,194,251,244,165,22,0,0,0,9,65,206,182,0,0,0,0,0,82,238,25,70,2,
+    0,2,150,202,29,212,236,207,230,213,48,0,0,17,44,25,0,0,7,191,191,191,191,191,
+    191,191,70,2,64,64,64,242,113,64,64,23,0,0,0,0,237,66,0,0,0,0,0,0,
+    0,237,66,0,0,0,0,0,0,0,237,66,0,0,0,0,0,0,0,237,66,0,0,0,
+    0,0,0,0,237,66,0,0,0,0,0,0,0,237,66,0,0,0,0,0,0,0,237,66,
+    0,0,0,183,44,0,0,0,86,142,244,59,0,0,0,115,189,244,59,0,0,0,115,189,
+    244,59,0,0,0,115,189,244,59,0,0,0,115,189,244,60,0,0,0,115,188,228,80,0,
+    0,0,136,173,157,181,5,0,20,222,102,19,186,234,207,240,151,3,0,0,21,45,14,0,
+    0,146,90,0,0,0,0,50,181,4,110,204,0,0,0,0,151,162,0,19,248,45,0,0,
+    8,239,64,0,0,170,141,0,0,88,221,1,0,0,73,232,5,0,184,125,0,0,0,3,
+    227,78,28,250,30,0,0,0,0,133,174,122,186,0,0,0,0,0,36,248,224,88,0,0,
+    0,0,0,0,193,238,8,0,0,0,97,131,0,0,0,158,132,0,0,0,157,72,74,230,
+    0,0,14,233,227,1,0,13,251,41,14,251,39,0,74,172,202,40,0,73,231,1,0,201,
+    102,0,137,109,140,103,0,136,167,0,0,137,166,0,200,46,78,167,0,199,103,0,0,73,
+    229,13,233,2,18,228,13,250,39,0,0,13,251,110,176,0,0,209,110,230,0,0,0,0,
+    200,229,114,0,0,147,229,166,0,0,0,0,137,255,51,0,0,85,255,102,0,0,11,179,
+    53,0,0,3,163,78,0,105,212,7,0,115,205,5,0,1,188,135,40,240,45,0,0,0,
+    32,239,215,123,0,0,0,0,0,180,246,12,0,0,0,0,77,229,193,137,0,0,0,18,
+    230,77,32,239,53,0,0,163,162,0,0,107,212,7,79,229,17,0,0,1,191,132,0,148,
+    96,0,0,0,33,186,24,0,51,239,34,0,1,191,130,0,0,0,129,193,2,108,207,6,
+    0,0,0,5,206,143,238,47,0,0,0,0,0,46,251,126,0,0,0,0,0,0,0,237,
+    66,0,0,0,0,0,0,0,237,66,0,0,0,0,0,0,0,237,66,0,0,0,0,0,
+    0,0,237,66,0,0,0,62,191,191,191,191,191,191,105,21,64,64,64,64,109,251,69,0,
+    0,0,0,19,221,117,0,0,0,0,4,187,166,0,0,0,0,0,142,206,10,0,0,0,
+    0,93,234,31,0,0,0,0,52,242,63,0,0,0,0,23,226,108,0,0,0,0,0,117,
+    255,255,255,255,255,255,174,31,32,16,247,198,99,247,28,0,247,28,0,247,28,0,247,28,
+    0,247,28,0,247,28,0,247,28,0,247,28,0,247,85,33,139,143,74,169,21,0,0,0,
+    157,97,0,0,0,78,176,0,0,0,9,235,10,0,0,0,175,79,0,0,0,97,157,0,
+    0,0,21,231,3,0,0,0,194,60,0,0,0,115,139,0,0,0,36,218,0,0,0,0,
+    31,1,27,32,21,159,219,166,0,111,166,0,111,166,0,111,166,0,111,166,0,111,166,0,
+    111,166,0,111,166,0,111,166,53,147,166,120,143,93,0,0,10,164,170,14,0,0,0,8,
+    186,170,159,196,12,0,7,182,146,2,1,133,192,10,60,95,0,0,0,0,88,67,0,0,
+    0,0,0,0,0,0,24,207,207,207,207,207,207,24,0,120,58,0,0,34,206,21,0,0,
+    53,81,0,82,160,178,146,30,0,0,111,71,52,130,219,4,0,0,9,32,32,224,51,0,
+    144,226,184,175,240,67,50,229,9,0,0,223,67,58,229,8,0,76,255,67,3,181,224,198,
+    177,214,67,0,0,34,29,0,0,0,29,6,0,0,0,0,232,44,0,0,0,0,232,44,
+    0,0,0,0,232,75,154,175,95,0,232,209,72,71,223,97,232,93,0,0,89,206,232,48,
+    0,0,44,242,232,63,0,0,59,229,232,163,1,0,159,158,232,153,208,211,208,23,0,0,
+    17,39,2,0,0,6,111,174,173,103,0,172,189,65,60,109,43,245,15,0,0,0,82,208,
+    0,0,0,0,68,226,0,0,0,0,10,233,90,0,0,16,0,59,224,206,202,193,0,0,
+    3,37,33,1,0,0,0,0,0,18,17,0,0,0,0,0,140,134,0,0,0,0,0,140,
+    134,0,17,142,177,115,143,134,0,193,162,52,121,238,134,47,239,7,0,0,189,134,83,201,
+    0,0,0,144,134,70,217,0,0,0,160,134,13,240,62,0,24,236,134,0,83,237,194,207,
+    178,134,0,0,12,41,5,0,0,0,6,112,174,165,65,0,0,169,175,60,80,228,60,40,
+    240,8,0,0,111,162,82,250,223,223,223,234,189,69,222,0,0,0,0,0,10,232,90,0,
+    0,5,29,0,54,218,209,195,229,96,0,0,1,33,39,6,0,0,0,6,32,14,0,67,
+    232,197,87,0,166,113,0,0,104,221,187,143,24,46,196,138,64,11,0,177,100,0,0,0,
+    177,100,0,0,0,177,100,0,0,0,177,100,0,0,0,177,100,0,0,0,20,144,177,115,
+    81,76,1,199,157,51,116,238,134,51,236,5,0,0,184,134,83,201,0,0,0,143,134,66,
+    222,0,0,0,164,134,9,232,91,0,46,241,134,0,59,215,235,185,163,131,0,0,0,0,
+    0,194,94,0,107,129,102,172,215,11,0,34,105,128,95,13,0,29,6,0,0,0,0,232,
+    44,0,0,0,0,232,44,0,0,0,0,232,69,149,176,103,0,232,199,80,78,232,75,232,
+    77,0,0,140,140,232,45,0,0,126,149,232,44,0,0,126,149,232,44,0,0,126,149,232,
+    44,0,0,126,149,28,7,222,53,55,13,125,30,222,53,222,53,222,53,222,53,222,53,222,
+    53,0,0,28,7,0,0,222,53,0,0,55,13,0,0,125,30,0,0,222,53,0,0,222,
+    53,0,0,222,53,0,0,222,53,0,0,222,53,0,0,222,53,0,0,227,48,24,132,235,
+    9,28,120,40,0,29,6,0,0,0,0,232,44,0,0,0,0,232,44,0,0,0,0,232,
+    44,0,7,126,64,232,44,17,192,142,2,232,75,211,112,0,0,232,239,143,0,0,0,232,
+    90,228,86,0,0,232,44,40,225,94,0,232,44,0,35,222,103,28,7,222,53,222,53,222,
+    53,222,53,222,53,222,53,222,53,222,53,222,53,131,52,152,175,82,8,128,177,121,2,232,
+    198,77,89,244,177,98,70,217,97,232,76,0,0,182,139,0,0,119,162,232,45,0,0,169,
+    108,0,0,106,171,232,44,0,0,169,108,0,0,106,171,232,44,0,0,169,108,0,0,106,
+    171,232,44,0,0,169,108,0,0,106,171,131,49,149,176,103,0,232,199,80,78,232,75,232,
+    77,0,0,140,140,232,45,0,0,126,149,232,44,0,0,126,149,232,44,0,0,126,149,232,
+    44,0,0,126,149,0,13,128,177,156,45,0,0,189,172,56,112,240,35,47,243,11,0,0,
+    168,136,83,207,0,0,0,120,171,70,223,0,0,0,137,159,13,240,73,0,17,224,86,0,
+    76,232,197,232,146,1,0,0,6,42,17,0,0,131,55,154,175,95,0,232,209,72,71,223,
+    97,232,93,0,0,89,206,232,48,0,0,44,242,232,63,0,0,59,229,232,163,1,0,159,
+    158,232,153,208,211,208,23,232,44,17,39,2,0,232,44,0,0,0,0,116,22,0,0,0,
+    0,0,17,142,177,115,81,76,0,193,162,52,121,238,134,47,239,7,0,0,189,134,83,201,
+    0,0,0,144,134,70,217,0,0,0,160,134,13,240,62,0,24,236,134,0,83,237,194,207,
+    178,134,0,0,12,41,5,140,134,0,0,0,0,0,140,134,0,0,0,0,0,70,67,131,
+    53,150,166,232,206,85,71,232,86,0,0,232,46,0,0,232,44,0,0,232,44,0,0,232,
+    44,0,0,0,73,166,179,152,34,40,234,77,49,88,46,67,218,16,0,0,0,5,164,244,
+    195,116,7,0,0,13,73,206,133,24,10,0,0,135,158,73,236,197,201,218,42,0,5,39,
+    34,2,0,0,99,22,0,0,0,226,50,0,0,97,242,165,143,60,43,233,101,64,27,0,
+    226,50,0,0,0,226,50,0,0,0,226,50,0,0,0,212,75,0,0,0,97,231,225,93,
+    141,14,0,0,81,74,250,25,0,0,143,131,250,25,0,0,143,131,250,25,0,0,143,131,
+    248,28,0,0,152,131,215,87,0,22,228,131,85,242,200,202,174,131,0,15,41,3,0,0,
+    77,87,0,0,0,72,92,62,226,2,0,0,202,88,1,221,68,0,43,239,8,0,126,163,
+    0,137,152,0,0,32,243,17,229,56,0,0,0,190,170,215,0,0,0,0,94,255,120,0,
+    0,61,94,0,0,115,88,0,0,121,34,56,220,0,9,238,210,0,15,247,13,4,240,32,
+    69,173,218,23,79,197,0,0,177,99,135,106,152,89,145,130,0,0,110,166,202,39,85,156,
+    212,63,0,0,44,237,223,0,20,233,244,7,0,0,1,231,159,0,0,206,185,0,0,33,
+    139,11,0,2,127,54,0,165,159,0,121,198,5,0,13,217,145,234,31,0,0,0,75,255,
+    105,0,0,0,5,199,192,210,9,0,0,138,184,2,171,152,0,74,228,22,0,16,222,86,
+    76,88,0,0,0,73,91,52,231,5,0,0,210,81,0,203,83,0,57,229,4,0,98,185,
+    0,159,131,0,0,10,236,49,242,31,0,0,0,143,222,181,0,0,0,0,40,255,78,0,
+    0,0,0,59,227,4,0,0,6,112,208,112,0,0,0,6,128,93,2,0,0,0,48,143,
+    143,143,143,112,27,80,80,80,209,163,0,0,0,118,206,12,0,0,84,225,27,0,0,55,
+    233,48,0,0,33,229,74,0,0,0,124,248,223,223,223,175,0,0,0,5,29,4,0,0,
+    76,233,192,26,0,0,163,120,0,0,0,0,173,104,0,0,0,0,175,103,0,0,0,26,
+    225,67,0,0,104,233,195,4,0,0,0,4,212,80,0,0,0,0,174,103,0,0,0,0,
+    173,104,0,0,0,0,158,134,0,0,0,0,53,209,212,28,23,25,122,132,122,132,122,132,
+    122,132,122,132,122,132,122,132,122,132,122,132,122,132,122,132,99,108,16,23,0,0,0,0,
+    96,204,214,13,0,0,0,0,212,69,0,0,0,0,197,78,0,0,0,0,196,80,0,0,
+    0,0,161,150,7,0,0,0,50,241,216,28,0,0,173,122,0,0,0,0,196,79,0,0,
+    0,0,197,78,0,0,0,4,222,63,0,0,104,219,173,6,0,0,14,117,159,119,30,0,
+    14,99,164,130,88,146,233,226,228,104,11,0,0,0,2,28,4,0,
+};
+
+inline constexpr FontData c_FontHint{ 12.0f, 11.1387f, 13.9688f, 32, 95, c_FontHintGlyphs, c_FontHintCoverage };
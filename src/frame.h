@@ -0,0 +1,85 @@
+#pragma once
+
+// plain data of one frame, copied from game elements after simulation step
+// renderer draws only frames, so it never touches game elements owned by logic thread
+
+struct ShapeSnapshot
+{
+    RectF rect;
+    Color color;
+};
+
+struct InfoSnapshot
+{
+    RectF rect;
+    Color color;
+    size_t score{};
+    size_t lives{};
+    bool paused{};
+    bool victory{};
+    bool fail{};
+};
+
+// latest input which got to frames, serial grows with each frame which shows input first
+struct InputStamp
+{
+    uint64_t serial{};
+    std::chrono::steady_clock::time_point received; // when window thread got input
+    std::chrono::steady_clock::time_point applied; // when tick applied it
+    std::chrono::steady_clock::time_point published; // when first frame showing it was published
+};
+
+struct FrameSnapshot
+{
+    uint64_t tick{};
+    std::chrono::steady_clock::time_point tickTime; // when tick was due
+    std::chrono::steady_clock::duration tickDuration{};
+    InputStamp input;
+
+    ShapeSnapshot playground;
+    InfoSnapshot info;
+    ShapeSnapshot player;
+    ShapeSnapshot ball;
+    RectF ballFrom; // ball bounds one tick before
+    std::vector<ShapeSnapshot> targets; // alive only, capacity is kept between frames
+    uint64_t targetsVersion{}; // Targets::GetVersion, frames with same nonzero version have same targets
+
+    // ball bounds interpolated between last two ticks, renders state one tick behind simulation
+    RectF GetBallBounds(std::chrono::steady_clock::time_point now) const noexcept
+    {
+        if (tickDuration <= std::chrono::steady_clock::duration::zero())
+            return ball.rect;
+
+        const auto alpha = std::clamp(std::chrono::duration<float>(now - tickTime) / tickDuration, 0.f, 1.f);
+
+        RectF rect = ball.rect;
+        rect.X = ballFrom.X + (ball.rect.X - ballFrom.X) * alpha;
+        rect.Y = ballFrom.Y + (ball.rect.Y - ballFrom.Y) * alpha;
+        return rect;
+    }
+};
+
+// targets only disappear during game and keep their order, so alive ones are subsequence of drawn ones
+// calls removed for each drawn target missing from alive, false if alive is not subsequence (new game or other layout)
+template <typename TRemoved>
+bool ForEachRemovedTarget(const std::vector<ShapeSnapshot>& drawn, const std::vector<ShapeSnapshot>& alive, TRemoved&& removed)
+{
+    if (alive.size() > drawn.size())
+        return false;
+
+    const auto isSame = [](const ShapeSnapshot& a, const ShapeSnapshot& b)
+    {
+        return a.rect.Equals(b.rect) && a.color.GetValue() == b.color.GetValue();
+    };
+
+    size_t next = 0;
+    for (const auto& target : drawn)
+    {
+        if (next < alive.size() && isSame(target, alive[next]))
+            ++next;
+        else
+            removed(target);
+    }
+
+    return next == alive.size();
+}
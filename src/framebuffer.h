@@ -0,0 +1,61 @@
+#pragma once
+
+// 32 bit framebuffer in memory, pixels are ARGB values, in memory it is BGRA like GDI 32 bpp bitmaps
+class Framebuffer
+{
+public:
+    // keeps memory when size does not change
+    void Resize(int width, int height)
+    {
+        width = std::max(width, 0);
+        height = std::max(height, 0);
+        if (width == width_ && height == height_)
+            return;
+
+        width_ = width;
+        height_ = height;
+        pixels_.assign(size_t(width_) * size_t(height_), 0);
+        pixels_.shrink_to_fit();
+    }
+
+    int GetWidth() const noexcept { return width_; }
+    int GetHeight() const noexcept { return height_; }
+
+    uint32_t* GetRow(int y) noexcept { return pixels_.data() + size_t(y) * size_t(width_); }
+    const uint32_t* GetRow(int y) const noexcept { return pixels_.data() + size_t(y) * size_t(width_); }
+    const uint32_t* GetPixels() const noexcept { return pixels_.data(); }
+
+private:
+    std::vector<uint32_t> pixels_;
+    int width_{};
+    int height_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// few framebuffers used in turn, each one is reallocated only when window size changes
+template <size_t Count>
+class FramebufferPool
+{
+public:
+    // next framebuffer of size, content is left from frame drawn into it Count frames before
+    Framebuffer& Acquire(int width, int height)
+    {
+        current_ = next_;
+        next_ = (next_ + 1) % Count;
+
+        auto& res = framebuffers_[current_];
+        res.Resize(width, height);
+        return res;
+    }
+
+    // index of framebuffer returned by last Acquire
+    size_t GetCurrent() const noexcept
+    {
+        return current_;
+    }
+
+private:
+    std::array<Framebuffer, Count> framebuffers_;
+    size_t current_{};
+    size_t next_{};
+};
@@ -2,19 +2,27 @@
 
 #include "targetver.h"
 #define WIN32_LEAN_AND_MEAN             // Exclude rarely-used stuff from Windows headers
+#define NOMINMAX                        // std::min and std::max are used, GDI+ gets them by using declarations in pch.h
 // Windows Header Files
 #include <windows.h>
+#include <timeapi.h>
 // C RunTime Header Files
 #include <stdlib.h>
 #include <malloc.h>
 #include <memory.h>
 #include <tchar.h>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <cmath>
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
 #include <vector>
 #include <memory>
 #include <set>
 #include <map>
+#include <chrono>
+#include <random>
+#include <cstdio>
@@ -0,0 +1,248 @@
+#pragma once
+
+// fixed timestep game loop: simulation runs with constant tick length whatever sleep granularity and paint cost are,
+// rendering goes with its own rate
+
+#include "tracer.h"
+
+using TLoopClock = std::chrono::steady_clock;
+
+inline double ToMicroseconds(TLoopClock::duration duration) noexcept
+{
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// running mean, jitter (standard deviation), min and max of measured intervals, in microseconds
+class IntervalStats
+{
+public:
+    void Add(double value) noexcept
+    {
+        ++count_;
+        const auto delta = value - mean_;
+        mean_ += delta / double(count_);
+        m2_ += delta * (value - mean_);
+        min_ = (1 == count_) ? value : std::min(min_, value);
+        max_ = (1 == count_) ? value : std::max(max_, value);
+    }
+
+    void Reset() noexcept
+    {
+        *this = IntervalStats();
+    }
+
+    size_t GetCount() const noexcept { return count_; }
+    double GetMean() const noexcept { return mean_; }
+    double GetMin() const noexcept { return min_; }
+    double GetMax() const noexcept { return max_; }
+
+    double GetJitter() const noexcept
+    {
+        return count_ > 1 ? std::sqrt(m2_ / double(count_ - 1)) : 0.;
+    }
+
+    // one line like "tick: 100 x 25.1 us (jitter 3.2, min 20.0, max 41.7)"
+    std::string Format(const char* name) const
+    {
+        char buffer[160] = {};
+        std::snprintf(buffer, sizeof(buffer), "%s: %zu x %.1f us (jitter %.1f, min %.1f, max %.1f)",
+            name, count_, mean_, GetJitter(), min_, max_);
+        return buffer;
+    }
+
+private:
+    size_t count_{};
+    double mean_{};
+    double m2_{};
+    double min_{};
+    double max_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// accumulates real time and tells how many ticks of fixed length are due
+// time of more than maxTicksPerUpdate ticks is dropped, game slows down instead of trying to catch up forever
+class FixedTimestep
+{
+public:
+    FixedTimestep(double ticksPerSecond, size_t maxTicksPerUpdate)
+        : tick_(std::chrono::duration_cast<TLoopClock::duration>(std::chrono::duration<double>(1. / ticksPerSecond)))
+        , maxTicksPerUpdate_(maxTicksPerUpdate)
+    {
+    }
+
+    void Reset(TLoopClock::time_point now) noexcept
+    {
+        last_ = now;
+        accumulator_ = TLoopClock::duration::zero();
+    }
+
+    // ticks to run for time passed since last update
+    size_t Update(TLoopClock::time_point now) noexcept
+    {
+        accumulator_ += now - last_;
+        last_ = now;
+
+        auto ticks = size_t(accumulator_ / tick_);
+        if (ticks > maxTicksPerUpdate_)
+        {
+            dropped_ += ticks - maxTicksPerUpdate_;
+            ticks = maxTicksPerUpdate_;
+            accumulator_ %= tick_;
+        }
+        else
+        {
+            accumulator_ -= tick_ * ticks;
+        }
+
+        return ticks;
+    }
+
+    // time of last tick boundary, state after due ticks belongs to it
+    TLoopClock::time_point GetTickTime() const noexcept
+    {
+        return last_ - accumulator_;
+    }
+
+    TLoopClock::time_point GetNextTickTime() const noexcept
+    {
+        return GetTickTime() + tick_;
+    }
+
+    TLoopClock::duration GetTickDuration() const noexcept
+    {
+        return tick_;
+    }
+
+    // ticks skipped because loop fell behind more than catch-up limit
+    uint64_t GetDroppedTicks() const noexcept
+    {
+        return dropped_;
+    }
+
+private:
+    TLoopClock::duration tick_;
+    size_t maxTicksPerUpdate_{};
+    TLoopClock::time_point last_;
+    TLoopClock::duration accumulator_{};
+    uint64_t dropped_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// auto reset event: one thread waits for it, others set it, set before wait is not lost
+class WakeEvent
+{
+public:
+    void Notify()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ mutex_ };
+            signaled_ = true;
+        }
+        cv_.notify_one();
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        cv_.wait(lock, [this]() { return signaled_; });
+        signaled_ = false;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool signaled_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// runs ticks on time and requests frames with own rate until running is reset
+// step runs one tick and gets time it is due at, publish gets time of last tick after ticks of one update, frame is called with render rate,
+// report is called about once a second with tick stats of that second, they are reset after it
+// while idle returns true nothing can change without input, loop requests last frame and sleeps until wake is notified
+// (input, resize, new game or stop), real time of sleep is not run as ticks afterwards
+class GameLoop
+{
+public:
+    GameLoop(double ticksPerSecond, double framesPerSecond, size_t maxTicksPerUpdate)
+        : timestep_(ticksPerSecond, maxTicksPerUpdate)
+        , frame_(std::chrono::duration_cast<TLoopClock::duration>(std::chrono::duration<double>(1. / framesPerSecond)))
+    {
+    }
+
+    template <typename TIdle, typename TStep, typename TPublish, typename TFrame, typename TReport>
+    void Run(const std::atomic_bool& running, WakeEvent& wake, TIdle&& idle, TStep&& step, TPublish&& publish, TFrame&& frame,
+        TReport&& report)
+    {
+        auto now = TLoopClock::now();
+        timestep_.Reset(now);
+        auto nextFrame = now;
+        auto nextReport = now + std::chrono::seconds(1);
+
+        while (running.load())
+        {
+            const auto ticks = timestep_.Update(now);
+            for (size_t i = 0; i < ticks; ++i)
+            {
+                const auto start = TLoopClock::now();
+                step(timestep_.GetTickTime() - timestep_.GetTickDuration() * (ticks - 1 - i));
+                tickStats_.Add(ToMicroseconds(TLoopClock::now() - start));
+            }
+
+            if (ticks > 0)
+                publish(timestep_.GetTickTime());
+
+            if (now >= nextFrame)
+            {
+                frame();
+
+                // skip frames missed, do not burst them
+                nextFrame += frame_;
+                if (nextFrame <= now)
+                    nextFrame = now + frame_;
+            }
+
+            if (now >= nextReport)
+            {
+                report();
+                tickStats_.Reset();
+                nextReport = now + std::chrono::seconds(1);
+            }
+
+            if (idle())
+            {
+                frame();
+                {
+                    TraceScope trace("idle");
+                    wake.Wait();
+                }
+                ++wakeUps_;
+
+                // first tick is due at once, it takes inputs which woke loop up
+                now = TLoopClock::now();
+                timestep_.Reset(now - timestep_.GetTickDuration());
+                nextFrame = now;
+                nextReport = now + std::chrono::seconds(1);
+                continue;
+            }
+
+            {
+                TraceScope trace("sleep");
+                std::this_thread::sleep_until(std::min(timestep_.GetNextTickTime(), nextFrame));
+            }
+            now = TLoopClock::now();
+        }
+    }
+
+    const FixedTimestep& GetTimestep() const noexcept { return timestep_; }
+    const IntervalStats& GetTickStats() const noexcept { return tickStats_; }
+
+    // how many times loop woke up from idle
+    uint64_t GetWakeUps() const noexcept { return wakeUps_; }
+
+private:
+    FixedTimestep timestep_;
+    TLoopClock::duration frame_;
+    IntervalStats tickStats_;
+    uint64_t wakeUps_{};
+};
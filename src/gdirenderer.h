@@ -0,0 +1,77 @@
+#pragma once
+
+#include "renderer.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// GDI+ backend, draws into graphics set by Begin
+// fonts are created on first use, GDI+ has to be started by then
+class GdiPlusRenderer
+    : public IRenderer
+{
+public:
+    void Begin(Graphics* graphics) noexcept
+    {
+        graphics_ = graphics;
+    }
+
+    // frees GDI+ objects, has to be called before GDI+ shutdown
+    void Release() noexcept
+    {
+        graphics_ = nullptr;
+        textFont_.reset();
+        hintFont_.reset();
+    }
+
+    void SetClip(const RectF* rect) override final
+    {
+        if (nullptr != rect)
+            graphics_->SetClip(*rect);
+        else
+            graphics_->ResetClip();
+    }
+
+    void FillRectangle(const RectF& rect, const Color& color) override final
+    {
+        const SolidBrush sb(color);
+        graphics_->FillRectangle(&sb, rect);
+    }
+
+    void FillRectangles(const RectF* rects, size_t count, const Color& color) override final
+    {
+        const SolidBrush sb(color);
+        graphics_->FillRectangles(&sb, rects, INT(count));
+    }
+
+    void FillEllipse(const RectF& rect, const Color& color) override final
+    {
+        const SolidBrush sb(color);
+        graphics_->FillEllipse(&sb, rect);
+    }
+
+    // GDI+ lays out string itself when drawing, run keeps text and its measured bounds
+    void LayoutGlyphRun(LPCWSTR text, eFont font, const PointF& origin, GlyphRun& run) override final
+    {
+        run.Reset(text, font, origin);
+        graphics_->MeasureString(run.text, INT(run.length), GetFont(font), origin, &run.bounds);
+    }
+
+    void DrawGlyphRun(const GlyphRun& run, const Color& color) override final
+    {
+        const StringFormat sf;
+        const SolidBrush brush(color);
+        graphics_->DrawString(run.text, INT(run.length), GetFont(run.font), run.origin, &sf, &brush);
+    }
+
+private:
+    const Gdiplus::Font* GetFont(eFont font)
+    {
+        auto& res = (eFont::hint == font) ? hintFont_ : textFont_;
+        if (!res)
+            res = std::make_unique<Gdiplus::Font>(L"Arial", eFont::hint == font ? 12.f : 14.f, FontStyleRegular, UnitPixel);
+        return res.get();
+    }
+
+    Graphics* graphics_ = nullptr;
+    std::unique_ptr<Gdiplus::Font> textFont_;
+    std::unique_ptr<Gdiplus::Font> hintFont_;
+};
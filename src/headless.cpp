@@ -0,0 +1,1801 @@
+// headless.cpp : Runs game simulations without a window, used to tune GameSettings.
+//
+
+#include "pch.h"
+#include "simulation.h"
+#include "gameloop.h"
+#include "triplebuffer.h"
+#include "painter.h"
+#include "softrenderer.h"
+#include "damage.h"
+#include "layer.h"
+#include "inputqueue.h"
+#include "latency.h"
+#include "profiler.h"
+#include "tracer.h"
+#include "replay.h"
+#include "rewind.h"
+#include "savegame.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <random>
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// counting global allocator, used by check-alloc
+namespace
+{
+    std::atomic<size_t> g_Allocations{ 0 };
+}
+
+// GCC sees free of pointer from inlined operator new and warns, replacement of both is intended
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(size_t size)
+{
+    g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto res = std::malloc(size ? size : 1))
+        return res;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+    constexpr size_t c_MaxTicksPerGame = 2000000;
+
+    // simple autopilot - keeps player under the ball
+    GameInputs GetBotInputs(const GameSimulation& game)
+    {
+        GameInputs inputs;
+
+        const auto ball = game.GetBall()->GetBounds();
+        const auto player = game.GetPlayer()->GetBounds();
+
+        const auto ballCenter = ball->X + ball->Width / 2.f;
+
+        if (ballCenter < player->GetLeft())
+            inputs.playerMoves = -1;
+        else if (ballCenter > player->GetRight())
+            inputs.playerMoves = 1;
+
+        return inputs;
+    }
+
+    // autopilot that moves player at once under point where falling ball reaches it
+    // inputs change only after contacts, so it plays same game per tick and event driven
+    GameInputs GetAimInputs(const GameSimulation& game)
+    {
+        GameInputs inputs;
+
+        const auto ball = game.GetBall();
+        const auto movement = ball->GetMovement();
+        if (!(movement.Y > 0.f))
+            return inputs;
+
+        const auto bounds = ball->GetBounds();
+        const auto player = game.GetPlayer()->GetBounds();
+        const auto playground = game.GetPlayground()->GetBounds();
+
+        // center of ball when it reaches player, reflected from side walls
+        const auto time = (player->GetTop() - bounds->GetBottom()) / movement.Y;
+        const auto low = playground->GetLeft() + bounds->Width / 2.f;
+        const auto width = playground->Width - bounds->Width;
+        if (!(width > 0.f))
+            return inputs;
+
+        auto x = std::fmod(bounds->X + bounds->Width / 2.f + movement.X * time - low, 2.f * width);
+        if (x < 0.f)
+            x += 2.f * width;
+        if (x > width)
+            x = 2.f * width - x;
+        x += low;
+
+        inputs.playerMoves = int(std::floor((x - player->GetLeft()) / player->Width));
+        return inputs;
+    }
+
+    enum class eBotMode
+    {
+        follow, // follows ball every tick
+        aim,    // aims every tick
+        events, // aims after contacts, ticks between them are run by GameSimulation::Advance
+    };
+
+    struct GameResult
+    {
+        size_t ticks = 0;
+        size_t score = 0;
+        bool victory = false;
+    };
+
+    GameResult PlayGame(const GameSettings& settings, eBotMode mode, uint64_t seed)
+    {
+        GameSimulation game(settings);
+        game.NewGame(seed);
+
+        while (!game.GetGameInformation()->IsOver() && game.GetTick() < c_MaxTicksPerGame)
+        {
+            switch (mode)
+            {
+            case eBotMode::follow:
+                game.Step(GetBotInputs(game));
+                break;
+            case eBotMode::aim:
+                game.Step(GetAimInputs(game));
+                break;
+            case eBotMode::events:
+            {
+                const auto inputs = GetAimInputs(game);
+                if (0 != inputs.playerMoves)
+                    game.Step(inputs);
+                else
+                    game.Advance(size_t(c_MaxTicksPerGame - game.GetTick()));
+                break;
+            }
+            }
+        }
+
+        GameResult res;
+        res.ticks = size_t(game.GetTick());
+        res.score = game.GetGameInformation()->GetScore();
+        res.victory = game.GetGameInformation()->IsVictory();
+        return res;
+    }
+
+    double GetSeconds(std::chrono::steady_clock::time_point start)
+    {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // dense board of targets, ball at random places of it, compares per target Ball::HitWithTarget with batched kernels
+    int RunCollideBenchmark(size_t lines, size_t lineSize)
+    {
+        constexpr float c_Width = 20.f;
+        constexpr float c_Height = 10.f;
+        constexpr float c_Margin = 2.f;
+        constexpr size_t c_Queries = 20000;
+
+        const auto count = lines * lineSize;
+
+        std::mt19937 rnd(1);
+
+        std::vector<RectF> bounds(count);
+        TargetRects rects;
+        rects.Resize(count);
+        Bitmask alive;
+        alive.Assign(count, true);
+
+        for (size_t line = 0; line < lines; ++line)
+        {
+            for (size_t pos = 0; pos < lineSize; ++pos)
+            {
+                const auto i = line * lineSize + pos;
+                bounds[i] = RectF(c_Margin + pos * (c_Width + c_Margin), c_Margin + (lines - line - 1) * (c_Height + c_Margin), c_Width, c_Height);
+                rects.Set(i, bounds[i]);
+
+                // quarter of targets is already destroyed
+                if (0 == rnd() % 4)
+                    alive.Reset(i);
+            }
+        }
+
+        const RectF area(0.f, 0.f, c_Margin + lineSize * (c_Width + c_Margin), c_Margin + lines * (c_Height + c_Margin));
+        const PointF directions[] = { { 0.5f, 1.f }, { -0.5f, 1.f }, { 0.5f, -1.f }, { -0.5f, -1.f }, { 1.f, 0.f } };
+
+        std::vector<Ball> balls;
+        balls.reserve(c_Queries);
+        std::uniform_real_distribution<float> coord(0.f, 1.f);
+        for (size_t i = 0; i < c_Queries; ++i)
+        {
+            balls.emplace_back(Color::White, 7.f, 0.005f, directions[i % std::size(directions)], PointF(coord(rnd), coord(rnd)), 1);
+            balls.back().Layout(&area);
+        }
+
+        std::printf("targets:     %zu (%zu x %zu)\n", count, lines, lineSize);
+
+        // reference - per target test in same order as Targets::GetTargetHitWithBall
+        std::vector<size_t> expected(c_Queries, c_NoHit);
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t q = 0; q < c_Queries; ++q)
+            {
+                Ball ball = balls[q];
+                const bool down = ball.MovingDown();
+                for (size_t l = 0; l < lines && c_NoHit == expected[q]; ++l)
+                {
+                    const auto line = down ? lines - l - 1 : l;
+                    for (size_t pos = 0; pos < lineSize; ++pos)
+                    {
+                        const auto i = line * lineSize + pos;
+                        if (alive.Test(i) && ball.HitWithTarget(&bounds[i]))
+                        {
+                            expected[q] = i;
+                            break;
+                        }
+                    }
+                }
+            }
+            std::printf("per target:  %.1f ns/query\n", GetSeconds(start) * 1e9 / c_Queries);
+        }
+
+        const std::pair<eSimdLevel, const char*> levels[] = {
+            { eSimdLevel::scalar, "scalar" },
+            { eSimdLevel::sse2, "sse2" },
+            { eSimdLevel::avx2, "avx2" } };
+
+        for (const auto& level : levels)
+        {
+            if (level.first > GetSupportedSimdLevel())
+                break;
+
+            const auto findFirstHit = GetFindFirstHit(level.first);
+
+            size_t mismatches = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t q = 0; q < c_Queries; ++q)
+            {
+                const auto& ball = balls[q];
+
+                eHitFace first = eHitFace::none;
+                eHitFace second = eHitFace::none;
+                ball.GetTargetHitOrder(first, second);
+
+                const bool down = ball.MovingDown();
+                size_t hit = c_NoHit;
+                for (size_t l = 0; l < lines && c_NoHit == hit; ++l)
+                {
+                    const auto line = down ? lines - l - 1 : l;
+                    eHitFace face = eHitFace::none;
+                    hit = findFirstHit(rects, alive, line * lineSize, (line + 1) * lineSize, *ball.GetBounds(), first, second, face);
+                }
+
+                if (hit != expected[q])
+                    ++mismatches;
+            }
+            std::printf("%-6s       %.1f ns/query, %zu mismatches\n", level.second, GetSeconds(start) * 1e9 / c_Queries, mismatches);
+        }
+
+        return 0;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // ball step as it was computed before direction became unit vector
+    PointF GetTrigStep(const PointF& direction, float speed)
+    {
+        const auto angle = atanf(fabs(direction.X) / fabs(direction.Y));
+        auto dx = speed * sinf(angle);
+        auto dy = speed * cosf(angle);
+
+        if (std::signbit(direction.X))
+            dx = -dx;
+        if (std::signbit(direction.Y))
+            dy = -dy;
+
+        return PointF(dx, dy);
+    }
+
+    // per tick cost of ball integration - trig based step against unit direction vector
+    int RunIntegrateBenchmark(size_t ticks)
+    {
+        constexpr size_t c_Directions = 64;
+        constexpr float c_Speed = 0.005f;
+
+        std::mt19937 rnd(1);
+        std::uniform_real_distribution<float> coord(-1.f, 1.f);
+
+        std::vector<PointF> directions;
+        std::vector<PointF> units;
+        for (size_t i = 0; i < c_Directions; ++i)
+        {
+            const PointF direction(coord(rnd), coord(rnd));
+            const auto length = std::hypot(direction.X, direction.Y);
+            directions.push_back(direction);
+            units.emplace_back(direction.X / length, direction.Y / length);
+        }
+
+        // same trajectories within tolerance
+        float maxDeviation = 0.f;
+        constexpr size_t c_TrajectoryTicks = 10000;
+        for (size_t i = 0; i < c_Directions; ++i)
+        {
+            PointF trig;
+            PointF unit;
+            for (size_t t = 0; t < c_TrajectoryTicks; ++t)
+            {
+                const auto step = GetTrigStep(directions[i], c_Speed);
+                trig.X += step.X;
+                trig.Y += step.Y;
+                unit.X += units[i].X * c_Speed;
+                unit.Y += units[i].Y * c_Speed;
+            }
+            maxDeviation = std::max(maxDeviation, std::hypot(trig.X - unit.X, trig.Y - unit.Y));
+        }
+        std::printf("deviation:   %g after %zu ticks (relative to playground)\n", maxDeviation, c_TrajectoryTicks);
+
+        {
+            PointF pos;
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < ticks; ++t)
+            {
+                const auto step = GetTrigStep(directions[t % c_Directions], c_Speed);
+                pos.X += step.X;
+                pos.Y += step.Y;
+            }
+            std::printf("trig step:   %.2f ns/tick (%g)\n", GetSeconds(start) * 1e9 / ticks, pos.X + pos.Y);
+        }
+
+        {
+            PointF pos;
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < ticks; ++t)
+            {
+                const auto& unit = units[t % c_Directions];
+                pos.X += unit.X * c_Speed;
+                pos.Y += unit.Y * c_Speed;
+            }
+            std::printf("unit step:   %.2f ns/tick (%g)\n", GetSeconds(start) * 1e9 / ticks, pos.X + pos.Y);
+        }
+
+        {
+            const RectF area(0.f, 0.f, 484.f, 501.f);
+            Ball ball(Color::White, 7.f, c_Speed, directions[0], PointF(0.5f, 0.5f), 1);
+            ball.Layout(&area);
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < ticks; ++t)
+                ball.Move(1.f);
+            std::printf("Ball::Move:  %.2f ns/tick (%g)\n", GetSeconds(start) * 1e9 / ticks, ball.GetBounds()->X);
+        }
+
+        return 0;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // settings for board of lines x lineSize targets in world of width x height, big boards are squeezed to upper half
+    GameSettings GetBoardSettings(size_t lines, size_t lineSize, float width, float height)
+    {
+        GameSettings settings;
+        settings.worldWidth = width;
+        settings.worldHeight = height;
+
+        if (lines == settings.targetLines.size() && lineSize == settings.targetsInLine)
+            return settings;
+
+        const std::pair<Color, size_t> kinds[] = { {Color::Yellow, 1}, {Color::Green, 3}, {Color::Orange, 5}, {Color::Red, 7} };
+
+        settings.targetLines.clear();
+        for (size_t line = 0; line < lines; ++line)
+            settings.targetLines[line] = kinds[line * std::size(kinds) / lines];
+
+        settings.targetsInLine = lineSize;
+        settings.targetsMargin = 1.f;
+        settings.targetsTopMargin = 10.f;
+        settings.targetHeight = std::max((height / 2.f) / lines - settings.targetsMargin, 1.f);
+        return settings;
+    }
+
+    uint64_t GetChecksum(const Framebuffer& framebuffer)
+    {
+        // FNV-1a over pixels
+        uint64_t res = 14695981039346656037ull;
+        const auto pixels = framebuffer.GetPixels();
+        for (size_t i = 0; i < size_t(framebuffer.GetWidth()) * size_t(framebuffer.GetHeight()); ++i)
+            res = (res ^ pixels[i]) * 1099511628211ull;
+        return res;
+    }
+
+    // copies pixels of rect from source to same place of target, as present does from framebuffer to window
+    void CopyRect(Framebuffer& target, const Framebuffer& source, const RectF& rect)
+    {
+        const auto left = std::max(int(rect.GetLeft()), 0);
+        const auto top = std::max(int(rect.GetTop()), 0);
+        const auto right = std::min(int(rect.GetRight()), source.GetWidth());
+        const auto bottom = std::min(int(rect.GetBottom()), source.GetHeight());
+        for (int y = top; y < bottom; ++y)
+            std::copy(source.GetRow(y) + left, source.GetRow(y) + right, target.GetRow(y) + left);
+    }
+
+    // hit of ball found by Targets (grid lookup and kernel of each SIMD level) has to be that of plain scan
+    // of all alive targets by Ball::HitWithTarget in same line order, and ball has to bounce same way
+    int RunCollideCheck(size_t queries)
+    {
+        const std::pair<size_t, size_t> boards[] = { { 8, 13 }, { 100, 100 } };
+        const std::pair<int, int> resolutions[] = { { 484, 561 }, { 1920, 1080 } };
+        const std::pair<eSimdLevel, const char*> levels[] = {
+            { eSimdLevel::scalar, "scalar" },
+            { eSimdLevel::sse2, "sse2" },
+            { eSimdLevel::avx2, "avx2" } };
+
+        std::mt19937 rnd(1);
+        std::uniform_real_distribution<float> coord(0.f, 1.f);
+        std::uniform_real_distribution<float> direction(-1.f, 1.f);
+
+        bool passed = true;
+
+        for (const auto& board : boards)
+        {
+            for (const auto& resolution : resolutions)
+            {
+                GameSimulation game(GetBoardSettings(board.first, board.second, float(resolution.first), float(resolution.second)));
+                game.NewGame();
+                Targets targets = *game.GetTargets();
+                const auto area = *game.GetPlayground()->GetBounds();
+
+                // third of targets is already destroyed
+                for (size_t i = 0; i < targets.GetCount(); ++i)
+                {
+                    if (0 == rnd() % 3)
+                        targets.RemoveTarget(i);
+                }
+
+                // balls in upper half of playground, where targets are, some move along one axis only
+                std::vector<Ball> balls;
+                balls.reserve(queries);
+                for (size_t i = 0; i < queries; ++i)
+                {
+                    PointF dir(direction(rnd), direction(rnd));
+                    if (0 == i % 7)
+                        dir.X = 0.f;
+                    else if (3 == i % 7)
+                        dir.Y = 0.f;
+                    balls.emplace_back(Color::White, 7.f, 0.005f, dir, PointF(coord(rnd), coord(rnd) / 2.f), 1);
+                    balls.back().Layout(&area);
+                }
+
+                std::vector<size_t> expected(queries, c_NoHit);
+                std::vector<PointF> bounced(queries);
+                size_t hits = 0;
+                for (size_t q = 0; q < queries; ++q)
+                {
+                    Ball ball = balls[q];
+                    const bool down = ball.MovingDown();
+                    for (size_t i = 0; i < targets.GetCount() && c_NoHit == expected[q]; ++i)
+                    {
+                        // lines from top when moving down, from bottom otherwise, targets of line from left
+                        const auto line = down ? targets.GetCount() / board.second - i / board.second - 1 : i / board.second;
+                        const auto target = line * board.second + i % board.second;
+                        if (targets.IsAlive(target) && ball.HitWithTarget(&targets.GetBounds(target)))
+                            expected[q] = target;
+                    }
+                    bounced[q] = ball.GetMovement();
+                    hits += c_NoHit == expected[q] ? 0 : 1;
+                }
+
+                std::printf("%3zu x %-3zu  %4d x %-4d  %zu hits of %zu", board.first, board.second, resolution.first, resolution.second,
+                    hits, queries);
+                for (const auto& level : levels)
+                {
+                    if (level.first > GetSupportedSimdLevel())
+                        break;
+
+                    targets.SetFindFirstHit(GetFindFirstHit(level.first));
+                    size_t mismatches = 0;
+                    for (size_t q = 0; q < queries; ++q)
+                    {
+                        Ball ball = balls[q];
+                        const auto hit = targets.GetTargetHitWithBall(&ball);
+                        const auto movement = ball.GetMovement();
+                        mismatches += (hit == expected[q] && movement.X == bounced[q].X && movement.Y == bounced[q].Y) ? 0 : 1;
+                    }
+                    std::printf("  %s %zu mismatches", level.second, mismatches);
+                    passed = passed && 0 == mismatches;
+                }
+                std::printf("\n");
+                passed = passed && 0 != hits;
+            }
+        }
+
+        std::printf("%s\n", passed ? "passed" : "FAILED");
+        return passed ? 0 : 1;
+    }
+
+    // frame cost of software renderer for standard and big boards at several resolutions, per SIMD level,
+    // and of frame composed from prerendered target layer, all of them have to produce same pixels
+    int RunRenderBenchmark()
+    {
+        const std::pair<size_t, size_t> boards[] = { { 8, 13 }, { 100, 100 } };
+        const std::pair<int, int> resolutions[] = { { 484, 561 }, { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+
+        const std::pair<eSimdLevel, const char*> levels[] = {
+            { eSimdLevel::scalar, "scalar" },
+            { eSimdLevel::sse2, "sse2" },
+            { eSimdLevel::avx2, "avx2" } };
+
+        FramePainter painter;
+        Framebuffer framebuffer;
+        FrameArena arena;
+
+        for (const auto& board : boards)
+        {
+            for (const auto& resolution : resolutions)
+            {
+                GameSimulation game(GetBoardSettings(board.first, board.second, float(resolution.first), float(resolution.second)));
+                game.NewGame();
+
+                FrameSnapshot frame;
+                game.Capture(frame);
+
+                framebuffer.Resize(resolution.first, resolution.second);
+
+                std::printf("%3zu x %-3zu  %4d x %-4d ", board.first, board.second, resolution.first, resolution.second);
+
+                uint64_t expected = 0;
+                for (const auto& level : levels)
+                {
+                    if (level.first > GetSupportedSimdLevel())
+                        break;
+
+                    SoftwareRenderer renderer(framebuffer, level.first);
+
+                    // at least 10 frames and 0.2 s
+                    size_t frames = 0;
+                    const auto start = std::chrono::steady_clock::now();
+                    do
+                    {
+                        painter.Draw(&renderer, frame, frame.tickTime, arena);
+                        arena.Reset();
+                        ++frames;
+                    } while (frames < 10 || GetSeconds(start) < 0.2);
+                    const auto elapsed = GetSeconds(start);
+
+                    const auto checksum = GetChecksum(framebuffer);
+                    if (eSimdLevel::scalar == level.first)
+                        expected = checksum;
+
+                    std::printf("  %s %7.3f ms%s", level.second, elapsed * 1e3 / frames, checksum == expected ? "" : " (mismatch)");
+                }
+
+                {
+                    TargetLayer layer;
+                    layer.Update(painter, frame, resolution.first, resolution.second);
+                    SoftwareRenderer renderer(framebuffer);
+                    const RectF all(0.f, 0.f, float(resolution.first), float(resolution.second));
+
+                    size_t frames = 0;
+                    const auto start = std::chrono::steady_clock::now();
+                    do
+                    {
+                        layer.Draw(renderer, painter, frame, frame.tickTime, arena, all);
+                        arena.Reset();
+                        ++frames;
+                    } while (frames < 10 || GetSeconds(start) < 0.2);
+                    const auto elapsed = GetSeconds(start);
+
+                    std::printf("  layer %7.3f ms%s", elapsed * 1e3 / frames, GetChecksum(framebuffer) == expected ? "" : " (mismatch)");
+                }
+                std::printf("\n");
+            }
+        }
+
+        return 0;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // bot plays, each frame is drawn whole and, as in game window, only its damage from target layer into pooled framebuffers
+    // window is emulated by surface which gets only presented rects, both framebuffer and window have to match whole frame
+    int RunDamageBenchmark(size_t frames)
+    {
+        const std::pair<size_t, size_t> boards[] = { { 8, 13 }, { 100, 100 } };
+        const std::pair<int, int> resolutions[] = { { 484, 561 }, { 1920, 1080 } };
+
+        FramePainter painter;
+        FrameArena arena;
+
+        for (const auto& board : boards)
+        {
+            for (const auto& resolution : resolutions)
+            {
+                GameSimulation game(GetBoardSettings(board.first, board.second, float(resolution.first), float(resolution.second)));
+                game.NewGame();
+
+                Framebuffer full;
+                full.Resize(resolution.first, resolution.second);
+                Framebuffer window;
+                window.Resize(resolution.first, resolution.second);
+                FramebufferPool<2> framebuffers;
+                DamageTracker<2> damage;
+                TargetLayer layer;
+                FrameSnapshot frame;
+
+                double fullSeconds = 0.;
+                double damageSeconds = 0.;
+                size_t damagedPixels = 0;
+                size_t mismatches = 0;
+                size_t windowMismatches = 0;
+
+                for (size_t i = 0; i < frames; ++i)
+                {
+                    // 100 ticks and 60 frames a second, frame is painted somewhere within tick
+                    const size_t ticks = (0 == i % 3) ? 1 : 2;
+                    for (size_t tick = 0; tick < ticks; ++tick)
+                    {
+                        if (game.GetGameInformation()->IsOver())
+                            game.NewGame();
+                        game.Step(GetBotInputs(game));
+                    }
+                    game.Capture(frame);
+                    frame.tickDuration = std::chrono::milliseconds(10);
+                    frame.tickTime = std::chrono::steady_clock::time_point(frame.tickDuration * frame.tick);
+                    const auto now = frame.tickTime + std::chrono::milliseconds(i % 10);
+
+                    auto start = std::chrono::steady_clock::now();
+                    SoftwareRenderer fullRenderer(full);
+                    painter.Draw(&fullRenderer, frame, now, arena);
+                    arena.Reset();
+                    fullSeconds += GetSeconds(start);
+
+                    start = std::chrono::steady_clock::now();
+                    auto& framebuffer = framebuffers.Acquire(resolution.first, resolution.second);
+                    const auto& region = damage.Track(framebuffers.GetCurrent(), resolution.first, resolution.second, frame, now);
+                    layer.Update(painter, frame, resolution.first, resolution.second);
+                    SoftwareRenderer renderer(framebuffer);
+                    for (const auto& rect : region.GetRects())
+                        layer.Draw(renderer, painter, frame, now, arena, rect);
+                    arena.Reset();
+                    damageSeconds += GetSeconds(start);
+
+                    for (const auto& rect : region.GetRects())
+                        CopyRect(window, framebuffer, rect);
+
+                    damagedPixels += region.GetArea();
+                    const auto expected = GetChecksum(full);
+                    mismatches += GetChecksum(framebuffer) == expected ? 0 : 1;
+                    windowMismatches += GetChecksum(window) == expected ? 0 : 1;
+                }
+
+                const auto pixels = double(resolution.first) * double(resolution.second) * double(frames);
+                std::printf("%3zu x %-3zu  %4d x %-4d   full %7.3f ms  damage %7.3f ms  %5.2f %% of pixels  %zu layer rebuilds  %zu mismatches  %zu in window\n",
+                    board.first, board.second, resolution.first, resolution.second, fullSeconds * 1e3 / frames,
+                    damageSeconds * 1e3 / frames, damagedPixels * 100. / pixels, layer.GetRebuilds(), mismatches, windowMismatches);
+            }
+        }
+
+        return 0;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // passes commands to other renderer and counts them
+    class CountingRenderer
+        : public IRenderer
+    {
+    public:
+        explicit CountingRenderer(IRenderer& renderer)
+            : renderer_(renderer)
+        {
+        }
+
+        void SetClip(const RectF* rect) override final { renderer_.SetClip(rect); }
+
+        void FillRectangle(const RectF& rect, const Color& color) override final
+        {
+            ++commands_;
+            renderer_.FillRectangle(rect, color);
+        }
+
+        void FillRectangles(const RectF* rects, size_t count, const Color& color) override final
+        {
+            ++commands_;
+            renderer_.FillRectangles(rects, count, color);
+        }
+
+        void FillEllipse(const RectF& rect, const Color& color) override final
+        {
+            ++commands_;
+            renderer_.FillEllipse(rect, color);
+        }
+
+        void LayoutGlyphRun(LPCWSTR text, eFont font, const PointF& origin, GlyphRun& run) override final
+        {
+            renderer_.LayoutGlyphRun(text, font, origin, run);
+        }
+
+        void DrawGlyphRun(const GlyphRun& run, const Color& color) override final
+        {
+            ++commands_;
+            renderer_.DrawGlyphRun(run, color);
+        }
+
+        size_t GetCommands() const noexcept { return commands_; }
+
+    private:
+        IRenderer& renderer_;
+        size_t commands_{};
+    };
+
+    // bot plays, playground with targets is drawn with fill per target and with color batches of FramePainter
+    // both ways have to produce same pixels
+    int RunBatchBenchmark(size_t frames)
+    {
+        const std::pair<size_t, size_t> boards[] = { { 8, 13 }, { 100, 100 } };
+        constexpr int c_Width = 1280;
+        constexpr int c_Height = 720;
+
+        FramePainter painter;
+        Framebuffer perTarget;
+        perTarget.Resize(c_Width, c_Height);
+        Framebuffer batched;
+        batched.Resize(c_Width, c_Height);
+
+        for (const auto& board : boards)
+        {
+            GameSimulation game(GetBoardSettings(board.first, board.second, float(c_Width), float(c_Height)));
+            game.NewGame();
+            FrameSnapshot frame;
+
+            double perTargetSeconds = 0.;
+            double batchedSeconds = 0.;
+            size_t perTargetCommands = 0;
+            size_t batchedCommands = 0;
+            size_t mismatches = 0;
+            const auto rebuilds = painter.GetTargetDrawList().GetRebuilds();
+
+            for (size_t i = 0; i < frames; ++i)
+            {
+                for (size_t tick = 0; tick < 2; ++tick)
+                {
+                    if (game.GetGameInformation()->IsOver())
+                        game.NewGame();
+                    game.Step(GetBotInputs(game));
+                }
+                game.Capture(frame);
+
+                {
+                    SoftwareRenderer software(perTarget);
+                    CountingRenderer renderer(software);
+                    const auto start = std::chrono::steady_clock::now();
+                    renderer.FillRectangle(frame.playground.rect, frame.playground.color);
+                    for (const auto& target : frame.targets)
+                        renderer.FillRectangle(target.rect, target.color);
+                    perTargetSeconds += GetSeconds(start);
+                    perTargetCommands += renderer.GetCommands();
+                }
+
+                {
+                    SoftwareRenderer software(batched);
+                    CountingRenderer renderer(software);
+                    const auto start = std::chrono::steady_clock::now();
+                    painter.DrawLayer(&renderer, frame, nullptr);
+                    batchedSeconds += GetSeconds(start);
+                    batchedCommands += renderer.GetCommands();
+                }
+
+                mismatches += GetChecksum(perTarget) == GetChecksum(batched) ? 0 : 1;
+            }
+
+            std::printf("%3zu x %-3zu  per target %7.1f commands %7.3f ms  batched %5.1f commands %7.3f ms  %zu rebuilds  %zu mismatches\n",
+                board.first, board.second, double(perTargetCommands) / frames, perTargetSeconds * 1e3 / frames,
+                double(batchedCommands) / frames, batchedSeconds * 1e3 / frames, painter.GetTargetDrawList().GetRebuilds() - rebuilds, mismatches);
+        }
+
+        return 0;
+    }
+
+    // bot plays, information panel is drawn by one painter whose cached text is invalidated every frame, so runs are laid out again
+    // into its reused storage, and by painter which keeps its cached runs, both ways have to produce same pixels
+    int RunTextBenchmark(size_t frames)
+    {
+        GameSimulation game;
+        game.NewGame();
+        FrameSnapshot frame;
+        FrameArena arena;
+
+        FramePainter painter;
+        FramePainter fresh; // its text is invalidated every frame, storage of painter is reused as in cached one
+        Framebuffer uncached;
+        Framebuffer cached;
+
+        double uncachedSeconds = 0.;
+        double cachedSeconds = 0.;
+        size_t mismatches = 0;
+
+        for (size_t i = 0; i < frames; ++i)
+        {
+            for (size_t tick = 0; tick < 2; ++tick)
+            {
+                if (game.GetGameInformation()->IsOver())
+                    game.NewGame();
+                game.Step(GetBotInputs(game));
+            }
+            game.Capture(frame);
+
+            const auto width = int(frame.info.rect.GetRight());
+            const auto height = int(frame.info.rect.GetBottom());
+            uncached.Resize(width, height);
+            cached.Resize(width, height);
+
+            {
+                auto start = std::chrono::steady_clock::now();
+                fresh.InvalidateText();
+                SoftwareRenderer renderer(uncached);
+                fresh.DrawOverLayer(&renderer, frame, frame.tickTime, arena, &frame.info.rect);
+                arena.Reset();
+                uncachedSeconds += GetSeconds(start);
+            }
+
+            {
+                auto start = std::chrono::steady_clock::now();
+                SoftwareRenderer renderer(cached);
+                painter.DrawOverLayer(&renderer, frame, frame.tickTime, arena, &frame.info.rect);
+                arena.Reset();
+                cachedSeconds += GetSeconds(start);
+            }
+
+            mismatches += GetChecksum(uncached) == GetChecksum(cached) ? 0 : 1;
+        }
+
+        std::printf("laid out every frame  %7.1f us  %zu layouts\n", uncachedSeconds * 1e6 / frames, fresh.GetTextLayouts());
+        std::printf("cached                %7.1f us  %zu layouts\n", cachedSeconds * 1e6 / frames, painter.GetTextLayouts());
+        std::printf("%zu mismatches\n", mismatches);
+        return 0;
+    }
+
+    // bot plays, ticks and frames go as in game window with software renderer, first with profiler disabled, then enabled
+    // prints what timers cost and phases as overlay of game window shows them, csv (if any) gets all samples of rings
+    int RunProfileBenchmark(size_t frames, const char* csv)
+    {
+        const int width = 484;
+        const int height = 561;
+
+        const auto play = [&](bool enabled)
+        {
+            g_Profiler.SetEnabled(enabled);
+
+            GameSimulation game;
+            game.NewGame();
+            game.Resize(RectF(0.f, 0.f, REAL(width), REAL(height)));
+
+            FrameSnapshot frame;
+            FramePainter painter;
+            FrameArena arena;
+            FramebufferPool<2> framebuffers;
+            DamageTracker<2> damage;
+            TargetLayer layer;
+
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < frames; ++i)
+            {
+                // 100 ticks and 60 frames a second
+                const size_t ticks = (0 == i % 3) ? 1 : 2;
+                for (size_t tick = 0; tick < ticks; ++tick)
+                {
+                    if (game.GetGameInformation()->IsOver())
+                        game.NewGame();
+                    game.Step(GetBotInputs(game));
+                }
+                game.Capture(frame);
+
+                auto& framebuffer = framebuffers.Acquire(width, height);
+                const auto& region = damage.Track(framebuffers.GetCurrent(), width, height, frame, frame.tickTime);
+                layer.Update(painter, frame, width, height);
+                SoftwareRenderer renderer(framebuffer);
+                for (const auto& rect : region.GetRects())
+                    layer.Draw(renderer, painter, frame, frame.tickTime, arena, rect);
+                arena.Reset();
+            }
+            return GetSeconds(start);
+        };
+
+        const auto disabledSeconds = play(false);
+        const auto enabledSeconds = play(true);
+        g_Profiler.SetEnabled(false);
+
+        std::printf("profiler disabled  %7.2f us per frame\n", disabledSeconds * 1e6 / frames);
+        std::printf("profiler enabled   %7.2f us per frame\n", enabledSeconds * 1e6 / frames);
+
+        // rings keep last samples of each phase, all of them are summarized
+        const auto now = std::chrono::steady_clock::now();
+        for (const auto& line : g_Profiler.Format(now, std::chrono::hours(1), 3))
+            std::printf("%ls\n", line.c_str());
+
+        if (nullptr != csv && !g_Profiler.ExportCsv(csv))
+            std::printf("cannot write %s\n", csv);
+
+        return 0;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // render path as in game window with software renderer: pooled framebuffer, damage tracker, target layer, painter, frame arena
+    // game runs and window is resized on the way, after warm-up frames with same window size must not allocate
+    int RunAllocationCheck(size_t frames)
+    {
+        constexpr size_t c_WarmUpFrames = 100;
+        const std::pair<int, int> sizes[] = { { 484, 561 }, { 1280, 720 } };
+
+        GameSimulation game;
+        game.NewGame();
+
+        TripleBuffer<FrameSnapshot> snapshots;
+        FramebufferPool<2> framebuffers;
+        DamageTracker<2> damage;
+        TargetLayer layer;
+        FrameArena arena(16); // small on purpose, it has to grow during warm-up
+        FramePainter painter;
+
+        size_t failed = 0;
+        for (const auto& size : sizes)
+        {
+            game.Resize(RectF(0.f, 0.f, float(size.first), float(size.second)));
+
+            size_t allocations = 0;
+            for (size_t i = 0; i < c_WarmUpFrames + frames; ++i)
+            {
+                // logic thread part, may allocate
+                for (size_t tick = 0; tick < 2; ++tick)
+                {
+                    if (game.GetGameInformation()->IsOver())
+                        game.NewGame();
+                    game.Step(GetBotInputs(game));
+                }
+                game.Capture(snapshots.GetBack());
+                snapshots.Publish();
+
+                // window thread part
+                const auto before = g_Allocations.load();
+
+                auto& framebuffer = framebuffers.Acquire(size.first, size.second);
+                SoftwareRenderer renderer(framebuffer);
+                const auto& frame = snapshots.GetFront();
+                const auto& region = damage.Track(framebuffers.GetCurrent(), size.first, size.second, frame, frame.tickTime);
+                layer.Update(painter, frame, size.first, size.second);
+                for (const auto& rect : region.GetRects())
+                    layer.Draw(renderer, painter, frame, frame.tickTime, arena, rect);
+                arena.Reset();
+
+                if (i >= c_WarmUpFrames)
+                    allocations += g_Allocations.load() - before;
+            }
+
+            std::printf("%4d x %-4d  %zu frames, %zu allocations, arena %zu bytes\n", size.first, size.second, frames, allocations, arena.GetCapacity());
+            failed += allocations > 0 ? 1 : 0;
+        }
+
+        std::printf("%s\n", 0 == failed ? "passed" : "FAILED");
+        return 0 == failed ? 0 : 1;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // real time game loop as in game window, bot plays, frames are taken from triple buffer by render thread
+    // prints tick and frame stats every second
+    // BREAKOUT_TRACE environment variable names file for trace of logic and render threads, as for game window
+    int RunGameLoop(double seconds, const char* latencyFile)
+    {
+        const char* tracePath = std::getenv("BREAKOUT_TRACE");
+        if (nullptr != tracePath && 0 != tracePath[0])
+            g_Tracer.Start();
+        g_Tracer.SetThreadName("logic");
+
+        const GameSettings settings;
+        GameSimulation game(settings);
+        game.NewGame();
+
+        const int width = 484;
+        const int height = 561;
+        game.Resize(RectF(0.f, 0.f, REAL(width), REAL(height)));
+
+        std::mutex lock;
+        TripleBuffer<FrameSnapshot> frames;
+        GameLoop loop(settings.ticksPerSecond, settings.framesPerSecond, settings.maxTicksPerUpdate);
+        InputQueue inputs;
+        InputStamper stamper; // guarded by lock
+
+        std::atomic_bool running = true;
+        std::atomic_bool frameDue = false;
+
+        // stands for window thread, paints when asked by loop as software path of window does,
+        // bot watches painted frames and sends its moves through input queue, so input to display latency is measured
+        std::thread render([&]()
+            {
+                g_Tracer.SetThreadName("render");
+
+                IntervalStats frameStats;
+                InputLatency latency;
+                FramePainter painter;
+                FrameArena arena;
+                FramebufferPool<2> framebuffers;
+                DamageTracker<2> damage;
+                TargetLayer layer;
+
+                auto lastFrame = TLoopClock::now();
+                auto lastReport = lastFrame;
+                float checksum = 0.f;
+
+                while (running.load())
+                {
+                    if (!frameDue.exchange(false))
+                    {
+                        std::this_thread::sleep_for(std::chrono::microseconds(200));
+                        continue;
+                    }
+
+                    TraceScope trace("paint");
+                    const auto paintStart = TLoopClock::now();
+                    const auto& frame = frames.GetFront();
+                    auto& framebuffer = framebuffers.Acquire(width, height);
+                    const auto& region = damage.Track(framebuffers.GetCurrent(), width, height, frame, paintStart);
+                    layer.Update(painter, frame, width, height);
+                    SoftwareRenderer renderer(framebuffer);
+                    for (const auto& rect : region.GetRects())
+                        layer.Draw(renderer, painter, frame, paintStart, arena, rect);
+                    arena.Reset();
+
+                    const auto now = TLoopClock::now();
+                    latency.Add(frame.input, paintStart, now);
+                    checksum += frame.GetBallBounds(paintStart).X;
+                    frameStats.Add(ToMicroseconds(paintStart - lastFrame));
+                    lastFrame = paintStart;
+
+                    // player is moved toward ball seen in frame
+                    const auto ballCenter = frame.ball.rect.X + frame.ball.rect.Width / 2.f;
+                    GameInputs moves;
+                    if (ballCenter < frame.player.rect.GetLeft())
+                        moves.playerMoves = -1;
+                    else if (ballCenter > frame.player.rect.GetRight())
+                        moves.playerMoves = 1;
+                    if (0 != moves.playerMoves)
+                        inputs.Push(moves, TLoopClock::now());
+
+                    if (now - lastReport >= std::chrono::seconds(1))
+                    {
+                        std::printf("%s\n", frameStats.Format("frame").c_str());
+                        std::printf("%s\n", latency.GetStage(InputLatency::total).Format("input to display").c_str());
+                        frameStats.Reset();
+                        lastReport = now;
+                    }
+                }
+                std::printf("checksum:    %g\n", checksum);
+                std::printf("%s", latency.Format().c_str());
+
+                if (nullptr != latencyFile && !latency.Dump(latencyFile))
+                    std::printf("cannot write %s\n", latencyFile);
+            });
+
+        const auto stop = TLoopClock::now() + std::chrono::duration_cast<TLoopClock::duration>(std::chrono::duration<double>(seconds));
+
+        // new game is started by loop itself, so only pause could make loop idle, nobody pauses here
+        WakeEvent wake;
+        loop.Run(running, wake,
+            [&]()
+            {
+                TraceLockGuard<std::mutex> guard{ lock, "wait lock", "hold lock" };
+                return game.GetGameInformation()->IsPaused();
+            },
+            [&](TLoopClock::time_point tickTime)
+            {
+                TraceScope trace("tick");
+                TraceLockGuard<std::mutex> guard{ lock, "wait lock", "hold lock" };
+                if (game.GetGameInformation()->IsOver())
+                    game.NewGame();
+                auto received = TLoopClock::time_point::max();
+                if (0 != inputs.Apply(game, tickTime, [&received](const InputEvent& event) { received = std::min(received, event.time); }))
+                    stamper.Applied(received, TLoopClock::now());
+                game.Step(GameInputs());
+            },
+            [&](TLoopClock::time_point tickTime)
+            {
+                TraceScope trace("publish");
+                TraceLockGuard<std::mutex> guard{ lock, "wait lock", "hold lock" };
+                auto& frame = frames.GetBack();
+                game.Capture(frame);
+                frame.tickTime = tickTime;
+                frame.tickDuration = loop.GetTimestep().GetTickDuration();
+                stamper.Stamp(frame, TLoopClock::now());
+                frames.Publish();
+            },
+            [&]()
+            {
+                frameDue.store(true);
+            },
+            [&]()
+            {
+                std::printf("%s, dropped ticks: %llu\n", loop.GetTickStats().Format("tick").c_str(),
+                    (unsigned long long)loop.GetTimestep().GetDroppedTicks());
+
+                if (TLoopClock::now() >= stop)
+                    running.store(false);
+            });
+
+        render.join();
+
+        if (g_Tracer.IsEnabled())
+        {
+            g_Tracer.Stop();
+            if (!g_Tracer.Write(tracePath))
+                std::printf("cannot write %s\n", tracePath);
+        }
+        return 0;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // real time game loop as in game window, game is paused for a while by input queued from other thread
+    // paused loop must neither tick nor request frames, it has to go on after pause is toggled again
+    int RunIdleCheck()
+    {
+        const GameSettings settings;
+        GameSimulation game(settings);
+        game.NewGame();
+
+        std::mutex lock;
+        WakeEvent wake;
+        InputQueue inputs;
+        std::atomic_bool running = true;
+        std::atomic<size_t> frames{ 0 };
+        GameLoop loop(settings.ticksPerSecond, settings.framesPerSecond, settings.maxTicksPerUpdate);
+
+        std::thread logic([&]()
+            {
+                loop.Run(running, wake,
+                    [&]()
+                    {
+                        std::lock_guard<std::mutex> guard{ lock };
+                        return game.IsIdle();
+                    },
+                    [&](TLoopClock::time_point tickTime)
+                    {
+                        std::lock_guard<std::mutex> guard{ lock };
+                        inputs.Apply(game, tickTime);
+                        game.Step(GetBotInputs(game));
+                    },
+                    [](TLoopClock::time_point) {},
+                    [&]()
+                    {
+                        frames.fetch_add(1);
+                    },
+                    []() {});
+            });
+
+        // stands for window thread, input is queued and logic thread is woken up as by ProcessUserInput
+        const auto togglePause = [&]()
+        {
+            GameInputs pause;
+            pause.togglePause = true;
+            inputs.Push(pause, TLoopClock::now());
+            wake.Notify();
+        };
+
+        const auto getTicks = [&]()
+        {
+            std::lock_guard<std::mutex> guard{ lock };
+            return game.GetTick();
+        };
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        togglePause();
+
+        // loop may finish update it was in and request last frame
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        const auto pausedTicks = getTicks();
+        const auto pausedFrames = frames.load();
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const auto idleTicks = getTicks() - pausedTicks;
+        const auto idleFrames = frames.load() - pausedFrames;
+
+        togglePause();
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        const auto resumedTicks = getTicks() - pausedTicks;
+
+        running.store(false);
+        wake.Notify();
+        logic.join();
+
+        const bool passed = 0 == idleTicks && 0 == idleFrames && resumedTicks > 0;
+        std::printf("paused 1 s:  %llu ticks, %zu frames\n", (unsigned long long)idleTicks, idleFrames);
+        std::printf("resumed:     %llu ticks in 0.3 s, %llu wake-ups\n", (unsigned long long)resumedTicks, (unsigned long long)loop.GetWakeUps());
+        std::printf("%s\n", passed ? "passed" : "FAILED");
+        return passed ? 0 : 1;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // producer thread pushes sequence numbers as fast as it can, consumer has to get all of them in order
+    int RunQueueCheck(size_t count)
+    {
+        SpscQueue<uint64_t, 256> queue;
+
+        std::thread producer([&]()
+            {
+                for (uint64_t i = 0; i < count; )
+                {
+                    if (queue.Push(i))
+                        ++i;
+                    else
+                        std::this_thread::yield();
+                }
+            });
+
+        size_t received = 0;
+        size_t mismatches = 0;
+        const auto start = std::chrono::steady_clock::now();
+        while (received < count)
+        {
+            const auto value = queue.Front();
+            if (nullptr == value)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            mismatches += (*value == received) ? 0 : 1;
+            queue.Pop();
+            ++received;
+        }
+        const auto elapsed = GetSeconds(start);
+
+        producer.join();
+
+        std::printf("%zu values, %zu out of order, %.1f ns/value\n", received, mismatches, elapsed * 1e9 / double(count));
+        std::printf("%s\n", 0 == mismatches ? "passed" : "FAILED");
+        return 0 == mismatches ? 0 : 1;
+    }
+
+    //---------------------------------------------------------------------------------------------------------------------------
+    // bot plays games one after another and they are recorded as game window records them: inputs of tick applied before step
+    // game is paused for a tick now and then and every other game is played in other world size, so recording has all events
+    int RunRecord(const char* path, size_t games, uint64_t seed)
+    {
+        GameSettings settings;
+        settings.seed = seed;
+        GameSimulation game(settings);
+        game.NewGame();
+
+        RewindBuffer rewind(settings.rewindSeconds, settings.ticksPerSecond, settings.rewindInterval);
+        std::vector<uint8_t> state;
+
+        ReplayRecorder recorder;
+        if (!recorder.Start(path, seed, game.GetWorld()))
+        {
+            std::printf("cannot write %s\n", path);
+            return 1;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        size_t played = 0;
+
+        for (;;)
+        {
+            const auto tick = game.GetTick();
+            if (recorder.IsKeyframeDue(tick))
+                recorder.Keyframe(game);
+
+            GameInputs inputs;
+            if (game.GetGameInformation()->IsOver())
+            {
+                if (++played == games)
+                    break;
+
+                const auto world = (0 == played % 2) ? RectF(0.f, 0.f, settings.worldWidth, settings.worldHeight) : RectF(0.f, 0.f, 640.f, 480.f);
+                game.Resize(world);
+                recorder.Resize(tick, world);
+                inputs.newGame = true;
+            }
+            else if (0 == tick % 2500 || (game.GetGameInformation()->IsPaused()))
+                inputs.togglePause = true;
+            else
+                inputs = GetBotInputs(game);
+
+            recorder.Record(tick, inputs);
+            rewind.Input(inputs);
+            game.ApplyInputs(inputs);
+
+            // goes back by one second now and then, as backspace in game window
+            if (1500 == tick % 3000 && rewind.Rewind(uint64_t(settings.ticksPerSecond), game))
+            {
+                game.SaveState(state);
+                recorder.State(tick, state);
+            }
+
+            game.Step(GameInputs());
+            rewind.Update(game);
+        }
+
+        const auto ok = recorder.Stop(game);
+        const auto elapsed = GetSeconds(start);
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        const auto bytes = uint64_t(file.tellg());
+
+        std::printf("games:       %zu\n", games);
+        std::printf("ticks:       %llu\n", (unsigned long long)game.GetTick());
+        std::printf("score:       %zu\n", game.GetGameInformation()->GetScore());
+        std::printf("file:        %llu bytes (%.2f bytes per 1000 ticks)\n", (unsigned long long)bytes, 1000. * double(bytes) / double(game.GetTick()));
+        std::printf("elapsed:     %.3f s\n", elapsed);
+        return ok ? 0 : 1;
+    }
+
+    // bot plays with snapshots taken as in game window, then
+    // every snapshot kept is restored and compared with state it was taken from, game rewound to snapshot plays on same as copy of game taken then,
+    // fork of game by LoadState into existing simulation is compared with copy of simulation
+    int RunRewindBenchmark(size_t ticks)
+    {
+        GameSettings settings;
+        GameSimulation game(settings);
+        game.NewGame();
+
+        RewindBuffer rewind(settings.rewindSeconds, settings.ticksPerSecond, settings.rewindInterval);
+        std::vector<std::vector<uint8_t>> states; // of all snapshots, in order
+        GameSimulation copy(settings); // game at snapshot, taken every 100 snapshots
+        size_t copyIndex = 0;
+
+        double captureSeconds = 0.;
+        size_t captures = 0;
+        for (size_t i = 0; i < ticks; ++i)
+        {
+            if (game.GetGameInformation()->IsOver())
+                game.NewGame();
+            game.Step(GetBotInputs(game));
+
+            const auto start = std::chrono::steady_clock::now();
+            const auto taken = rewind.Update(game);
+            captureSeconds += GetSeconds(start);
+            if (!taken)
+                continue;
+
+            states.emplace_back();
+            game.SaveState(states.back());
+            if (0 == captures++ % 100)
+            {
+                copy = game;
+                copyIndex = states.size() - 1;
+            }
+        }
+
+        const auto count = rewind.GetCount();
+        const auto span = rewind.GetSpan();
+        const auto stateBytes = rewind.GetStateBytes();
+        const auto memory = rewind.GetMemory();
+
+        bool passed = true;
+
+        std::vector<uint8_t> state;
+        GameSimulation restored(settings);
+        restored.NewGame();
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t back = 0; back < count; ++back)
+        {
+            passed = rewind.GetState(back, state)
+                && restored.LoadState(state.data(), state.size())
+                && state == states[states.size() - 1 - back]
+                && passed;
+        }
+        const auto restoreSeconds = GetSeconds(start);
+
+        // rewound game goes on as copy taken at same snapshot
+        std::vector<uint8_t> left;
+        std::vector<uint8_t> right;
+        const auto back = states.size() - 1 - copyIndex;
+        passed = back < count && rewind.Rewind(game.GetTick() - copy.GetTick(), game) && rewind.GetCount() == count - back && passed;
+        for (size_t i = 0; i < 10000 && passed; ++i)
+        {
+            game.Step(GetBotInputs(game));
+            copy.Step(GetBotInputs(copy));
+        }
+        game.SaveState(left);
+        copy.SaveState(right);
+        passed = left == right && passed;
+
+        // fork: copy of whole simulation vs state loaded into simulation kept for it
+        constexpr size_t c_Forks = 100000;
+        uint64_t sum = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < c_Forks; ++i)
+        {
+            GameSimulation fork(game);
+            sum += fork.GetGameInformation()->GetScore();
+        }
+        const auto copySeconds = GetSeconds(start);
+
+        game.SaveState(state);
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < c_Forks; ++i)
+        {
+            restored.LoadState(state.data(), state.size());
+            sum += restored.GetGameInformation()->GetScore();
+        }
+        const auto loadSeconds = GetSeconds(start);
+
+        const auto keyframes = (count + RewindBuffer::c_GroupSize - 1) / RewindBuffer::c_GroupSize;
+        const auto keyframeBytes = states.back().size();
+        std::printf("ticks:       %zu, snapshot every %zu ticks\n", ticks, settings.rewindInterval);
+        std::printf("snapshots:   %zu of %zu slots, %.1f s of game\n", count, rewind.GetCapacity(), double(span) / settings.ticksPerSecond);
+        std::printf("state:       %zu bytes, kept %zu bytes (%.1f bytes per delta), memory %zu bytes\n", keyframeBytes, stateBytes,
+            count > keyframes ? double(stateBytes - keyframes * keyframeBytes) / double(count - keyframes) : 0., memory);
+        std::printf("capture:     %.3f us per snapshot (%zu)\n", 1e6 * captureSeconds / double(captures), captures);
+        std::printf("restore:     %.3f us per snapshot\n", 1e6 * restoreSeconds / double(std::max<size_t>(count, 1)));
+        std::printf("fork:        copy %.3f us, load state %.3f us (%llu)\n", 1e6 * copySeconds / c_Forks, 1e6 * loadSeconds / c_Forks,
+            (unsigned long long)sum);
+        std::printf("%s\n", passed ? "passed" : "FAILED");
+        return passed ? 0 : 1;
+    }
+
+    // game is left without player moves until it is lost, rewind by one second has to bring back game in play with white ball,
+    // then new game comes by input and rewind soon after it has to stay in new game
+    int RunRewindCheck()
+    {
+        GameSettings settings;
+        GameSimulation game(settings);
+        game.NewGame();
+        RewindBuffer rewind(settings.rewindSeconds, settings.ticksPerSecond, settings.rewindInterval);
+
+        const auto second = uint64_t(settings.ticksPerSecond);
+        while (!game.GetGameInformation()->IsOver() && game.GetTick() < c_MaxTicksPerGame)
+        {
+            game.Step(GameInputs());
+            rewind.Update(game);
+        }
+
+        FrameSnapshot frame;
+        const auto lost = game.GetGameInformation()->IsFail();
+        const auto rewound = rewind.Rewind(second, game);
+        game.Capture(frame);
+        const auto back = !frame.info.fail && !frame.info.paused && Color(Color::White).GetValue() == frame.ball.color.GetValue();
+        std::printf("lost game:   %s, rewound %s, fail %d, paused %d, ball %08x\n", lost ? "yes" : "no", rewound ? "yes" : "no",
+            int(frame.info.fail), int(frame.info.paused), unsigned(frame.ball.color.GetValue()));
+
+        const auto oldSeed = game.GetSeed();
+        GameInputs inputs;
+        inputs.newGame = true;
+        rewind.Input(inputs);
+        game.ApplyInputs(inputs);
+        const auto newSeed = game.GetSeed();
+        const auto lives = game.GetGameInformation()->GetLives();
+
+        std::vector<uint8_t> first;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            game.Step(GameInputs());
+            if (rewind.Update(game) && first.empty())
+                game.SaveState(first);
+        }
+
+        std::vector<uint8_t> state;
+        const auto rewoundNew = rewind.Rewind(5 * second, game);
+        game.SaveState(state);
+        const auto stays = rewoundNew && newSeed != oldSeed && game.GetSeed() == newSeed && game.GetGameInformation()->GetLives() == lives
+            && state == first;
+        std::printf("new game:    seed %llu, rewound to seed %llu, lives %zu of %zu\n", (unsigned long long)newSeed,
+            (unsigned long long)game.GetSeed(), game.GetGameInformation()->GetLives(), lives);
+
+        const auto passed = lost && rewound && back && stays;
+        std::printf("%s\n", passed ? "passed" : "FAILED");
+        return passed ? 0 : 1;
+    }
+
+    // game in middle of play saved and loaded into other simulation count times, loaded game has to have same hash and play on same,
+    // then save goes through file, removed when done, and damaged save has to be refused
+    int RunSaveBenchmark(size_t count, const char* path)
+    {
+        GameSettings settings;
+        GameSimulation game(settings);
+        game.Resize(RectF(0.f, 0.f, 640.f, 480.f));
+        game.NewGame();
+        for (size_t i = 0; i < 5000 && !game.GetGameInformation()->IsOver(); ++i)
+            game.Step(GetBotInputs(game));
+
+        GameSimulation loaded(settings);
+        loaded.NewGame();
+
+        std::vector<uint8_t> save;
+        size_t failed = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+        {
+            SaveGame::Save(game, save);
+            failed += SaveGame::Load(loaded, save.data(), save.size()) ? 0 : 1;
+        }
+        const auto roundTripSeconds = GetSeconds(start);
+
+        bool passed = 0 == failed && loaded.GetStateHash() == game.GetStateHash();
+
+        // what save and load replace: elements created again, whole simulation copied
+        uint64_t sum = 0;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+        {
+            loaded.NewGame(game.GetSeed());
+            sum += loaded.GetTargets()->GetCount();
+        }
+        const auto createSeconds = GetSeconds(start);
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+        {
+            GameSimulation copy(game);
+            sum += copy.GetGameInformation()->GetScore();
+        }
+        const auto copySeconds = GetSeconds(start);
+
+        std::vector<uint8_t> read;
+        const auto written = SaveGame::Write(path, save) && SaveGame::Read(path, read) && read == save;
+        std::remove(path);
+        passed = written && SaveGame::Load(loaded, read.data(), read.size()) && loaded.GetStateHash() == game.GetStateHash() && passed;
+
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            game.Step(GetBotInputs(game));
+            loaded.Step(GetBotInputs(loaded));
+        }
+        passed = loaded.GetStateHash() == game.GetStateHash() && passed;
+
+        read.back() ^= 1;
+        passed = !SaveGame::Load(loaded, read.data(), read.size()) && passed;
+        read.resize(read.size() - 1);
+        passed = !SaveGame::Load(loaded, read.data(), read.size()) && passed;
+
+        // values out of range with checksum made for them: lives above start, score above all targets, paused 2, game state 3, speed NaN, direction not unit, alive count off by one,
+        // world NaN and 0 wide, refused save has to leave game as it was
+        const auto refused = [&save, &settings](size_t offset, const void* value, size_t size)
+        {
+            auto damaged = save;
+            std::memcpy(damaged.data() + offset, value, size);
+            SaveGameHeader header;
+            std::memcpy(&header, damaged.data(), sizeof(header));
+            header.checksum = SaveGame::GetChecksum(damaged.data() + sizeof(header), header.stateSize);
+            std::memcpy(damaged.data(), &header, sizeof(header));
+
+            GameSimulation target(settings);
+            target.NewGame();
+            const auto hash = target.GetStateHash();
+            const auto world = target.GetWorld();
+            return !SaveGame::Load(target, damaged.data(), damaged.size()) && hash == target.GetStateHash() && world.Equals(target.GetWorld());
+        };
+        const auto info = sizeof(SaveGameHeader) + GameSimulation::c_StateSize;
+        const auto ball = info + game.GetGameInformation()->GetStateSize() + Player::c_StateSize;
+        const auto targets = ball + Ball::c_StateSize;
+        const uint8_t two = 2;
+        const uint8_t three = 3;
+        const auto nan = std::numeric_limits<float>::quiet_NaN();
+        const auto half = 0.5f;
+        const auto alive = uint32_t(game.GetTargets()->GetCount() + 1);
+        const auto zero = 0.f;
+        const auto lives = uint64_t(settings.livesStart + 1);
+        const auto score = uint64_t(1) << 40;
+        size_t damaged = 0;
+        damaged += refused(info, &lives, 8) ? 1 : 0;
+        damaged += refused(info + 10, &score, 8) ? 1 : 0;
+        damaged += refused(info + 8, &two, 1) ? 1 : 0;
+        damaged += refused(info + 9, &three, 1) ? 1 : 0;
+        damaged += refused(ball + 16, &nan, 4) ? 1 : 0;
+        damaged += refused(ball + 8, &half, 4) ? 1 : 0;
+        damaged += refused(targets, &alive, 4) ? 1 : 0;
+        damaged += refused(offsetof(SaveGameHeader, worldWidth), &nan, 4) ? 1 : 0;
+        damaged += refused(offsetof(SaveGameHeader, worldHeight), &zero, 4) ? 1 : 0;
+        passed = 9 == damaged && passed;
+
+        // lost game comes back lost, with red ball
+        GameSimulation lost(settings);
+        lost.NewGame();
+        while (!lost.GetGameInformation()->IsOver())
+            lost.Step(GameInputs());
+        SaveGame::Save(lost, save);
+        GameSimulation lostLoaded(settings);
+        lostLoaded.NewGame();
+        FrameSnapshot lostFrame;
+        const auto lostOk = SaveGame::Load(lostLoaded, save.data(), save.size()) && lostLoaded.GetStateHash() == lost.GetStateHash();
+        lostLoaded.Capture(lostFrame);
+        passed = lostOk && lostFrame.info.fail && Color(Color::Red).GetValue() == lostFrame.ball.color.GetValue() && passed;
+
+        std::printf("save:        %zu bytes (header %zu, state %zu), %s %s\n", save.size(), sizeof(SaveGameHeader),
+            save.size() - sizeof(SaveGameHeader), path, written ? "written and read" : "NOT WRITTEN");
+        std::printf("round trip:  %.3f us, %.0f per second (%zu)\n", 1e6 * roundTripSeconds / double(count), double(count) / roundTripSeconds, count);
+        std::printf("new game:    %.3f us\n", 1e6 * createSeconds / double(count));
+        std::printf("copy:        %.3f us (%llu)\n", 1e6 * copySeconds / double(count), (unsigned long long)sum);
+        std::printf("checks:      %zu of 9 damaged saves refused, lost game loaded %s, fail %d, ball %08x\n", damaged,
+            lostOk ? "same" : "DIFFERENT", int(lostFrame.info.fail), unsigned(lostFrame.ball.color.GetValue()));
+        std::printf("%s\n", passed ? "passed" : "FAILED");
+        return passed ? 0 : 1;
+    }
+
+    // recording played as fast as possible, then again from keyframe in middle by player which did not play it yet,
+    // so play has to start from state stored in file, all keyframe and end hashes have to match
+    int RunReplay(const char* path)
+    {
+        ReplayPlayer player;
+        if (!player.Load(path))
+        {
+            std::printf("cannot read %s\n", path);
+            return 1;
+        }
+
+        bool passed = true;
+        const auto report = [&passed](const char* name, const ReplayPlayer::Result& res, double elapsed)
+        {
+            std::printf("%-8s from tick %-8llu %llu ticks, %zu events, %zu keyframes, %zu mismatches, end %s, score %llu, lives %llu, %.3f s, %.0f ticks/s\n",
+                name, (unsigned long long)res.startTick, (unsigned long long)res.ticks, res.events, res.keyframes, res.mismatches,
+                res.ended ? "matches" : "DIFFERS", (unsigned long long)res.score, (unsigned long long)res.lives, elapsed,
+                double(res.ticks - res.startTick) / elapsed);
+            passed = passed && res.ended && 0 == res.mismatches;
+        };
+
+        std::printf("seed %llu, world %.0f x %.0f, %zu keyframes\n", (unsigned long long)player.GetSeed(),
+            player.GetWorld().Width, player.GetWorld().Height, player.GetKeyframes().size());
+
+        auto start = std::chrono::steady_clock::now();
+        const auto whole = player.Play(0);
+        report("whole", whole, GetSeconds(start));
+
+        if (!player.GetKeyframes().empty())
+        {
+            ReplayPlayer fresh;
+            fresh.Load(path);
+            const auto tick = player.GetKeyframes()[player.GetKeyframes().size() / 2].tick;
+            start = std::chrono::steady_clock::now();
+            const auto seek = fresh.Play(tick);
+            report("seek", seek, GetSeconds(start));
+            passed = passed && seek.startTick == tick && seek.ticks == whole.ticks;
+        }
+
+        std::printf("%s\n", passed ? "passed" : "FAILED");
+        return passed ? 0 : 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-collide"))
+    {
+        const size_t lines = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+        const size_t lineSize = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 128;
+        return RunCollideBenchmark(lines, lineSize);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-integrate"))
+    {
+        const size_t ticks = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000000;
+        return RunIntegrateBenchmark(ticks);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-render"))
+        return RunRenderBenchmark();
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-damage"))
+    {
+        const size_t frames = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 3000;
+        return RunDamageBenchmark(frames);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-batch"))
+    {
+        const size_t frames = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000;
+        return RunBatchBenchmark(frames);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-text"))
+    {
+        const size_t frames = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+        return RunTextBenchmark(frames);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-profile"))
+    {
+        const size_t frames = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+        return RunProfileBenchmark(frames, argc > 3 ? argv[3] : nullptr);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "check-alloc"))
+    {
+        const size_t frames = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000;
+        return RunAllocationCheck(frames);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "check-queue"))
+    {
+        const size_t count = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000000;
+        return RunQueueCheck(count);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-rewind"))
+    {
+        const size_t ticks = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 100000;
+        return RunRewindBenchmark(ticks);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "bench-save"))
+    {
+        const size_t count = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+        const auto path = argc > 3 ? std::string(argv[3]) : (std::filesystem::temp_directory_path() / "breakout_save.brs").string();
+        return RunSaveBenchmark(count, path.c_str());
+    }
+
+    if (argc > 2 && 0 == std::strcmp(argv[1], "record"))
+    {
+        const size_t games = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 10;
+        const uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1;
+        return RunRecord(argv[2], games, seed);
+    }
+
+    if (argc > 2 && 0 == std::strcmp(argv[1], "replay"))
+        return RunReplay(argv[2]);
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "check-rewind"))
+        return RunRewindCheck();
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "check-idle"))
+        return RunIdleCheck();
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "check-collide"))
+    {
+        const size_t queries = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+        return RunCollideCheck(queries);
+    }
+
+    if (argc > 1 && 0 == std::strcmp(argv[1], "loop"))
+    {
+        const double seconds = argc > 2 ? std::strtod(argv[2], nullptr) : 5.;
+        return RunGameLoop(seconds, argc > 3 ? argv[3] : nullptr);
+    }
+
+    const size_t games = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100;
+    const uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+
+    auto mode = eBotMode::follow;
+    if (argc > 3 && 0 == std::strcmp(argv[3], "aim"))
+        mode = eBotMode::aim;
+    else if (argc > 3 && 0 == std::strcmp(argv[3], "events"))
+        mode = eBotMode::events;
+
+    const size_t threads = std::max<size_t>(1, argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 1);
+
+    // game seeds come as from GameSimulation playing games one after another, first game takes seed itself
+    // each game has generator of its own, so games go to threads without sharing anything and results do not depend on threads
+    std::vector<uint64_t> gameSeeds(games);
+    Random seeds(seed);
+    for (size_t i = 0; i < games; ++i)
+        gameSeeds[i] = 0 == i ? seed : seeds.Next64();
+
+    const GameSettings settings;
+    std::vector<GameResult> results(games);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]()
+            {
+                for (size_t i = t; i < games; i += threads)
+                    results[i] = PlayGame(settings, mode, gameSeeds[i]);
+            });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    const auto elapsed = GetSeconds(start);
+
+    size_t ticks = 0;
+    size_t score = 0;
+    size_t victories = 0;
+
+    for (const auto& res : results)
+    {
+        ticks += res.ticks;
+        score += res.score;
+        victories += res.victory ? 1 : 0;
+    }
+
+    std::printf("games:       %zu\n", games);
+    std::printf("victories:   %zu\n", victories);
+    std::printf("avg score:   %.2f\n", games ? double(score) / games : 0.);
+    std::printf("avg ticks:   %.0f\n", games ? double(ticks) / games : 0.);
+    std::printf("elapsed:     %.3f s\n", elapsed);
+    std::printf("games/s:     %.1f\n", games / elapsed);
+    std::printf("ticks/s:     %.0f\n", ticks / elapsed);
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+// inputs go from window thread to logic thread without lock, simulation takes them at start of tick
+
+#include "simulation.h"
+
+#include <array>
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// lock-free single producer single consumer ring buffer, Capacity has to be power of two
+// producer side (Push) and consumer side (Front, Pop) must be used by one thread at a time each
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(0 != Capacity && 0 == (Capacity & (Capacity - 1)), "capacity has to be power of two");
+
+public:
+    // false when queue is full, value is dropped then
+    bool Push(const T& value) noexcept
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity)
+            return false;
+
+        slots_[tail & c_Mask] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // oldest value, nullptr when queue is empty
+    const T* Front() const noexcept
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+            return nullptr;
+
+        return &slots_[head & c_Mask];
+    }
+
+    // removes value returned by Front
+    void Pop() noexcept
+    {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    static constexpr size_t c_Mask = Capacity - 1;
+
+    // positions only grow, each of them is written by one side, on own cache line
+    alignas(64) std::atomic<size_t> head_{};
+    alignas(64) std::atomic<size_t> tail_{};
+    alignas(64) std::array<T, Capacity> slots_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+struct InputEvent
+{
+    GameInputs inputs;
+    std::chrono::steady_clock::time_point time; // when window thread got input
+};
+
+// inputs are applied in order they came, at start of first tick due after them
+class InputQueue
+{
+public:
+    // window thread, false when queue is full and input is dropped
+    bool Push(const GameInputs& inputs, std::chrono::steady_clock::time_point time) noexcept
+    {
+        if (queue_.Push({ inputs, time }))
+            return true;
+
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // logic thread, applies inputs which came before tick time, returns how many
+    // applied is called with each event before its inputs are applied
+    template <typename TApplied>
+    size_t Apply(GameSimulation& simulation, std::chrono::steady_clock::time_point tickTime, TApplied&& applied)
+    {
+        size_t res = 0;
+        for (auto event = queue_.Front(); nullptr != event && event->time <= tickTime; event = queue_.Front())
+        {
+            applied(*event);
+            simulation.ApplyInputs(event->inputs);
+            queue_.Pop();
+            ++res;
+        }
+        return res;
+    }
+
+    size_t Apply(GameSimulation& simulation, std::chrono::steady_clock::time_point tickTime)
+    {
+        return Apply(simulation, tickTime, [](const InputEvent&) {});
+    }
+
+    uint64_t GetDropped() const noexcept
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    SpscQueue<InputEvent, 256> queue_;
+    std::atomic<uint64_t> dropped_{};
+};
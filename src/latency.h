@@ -0,0 +1,177 @@
+#pragma once
+
+// input to display latency: logic thread stamps frames with input they show first, window thread adds paint start
+// and end of present and collects durations of stages into histograms
+
+#include "frame.h"
+#include "gameloop.h"
+
+#include <array>
+#include <fstream>
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// histogram of durations in microseconds, 8 buckets per power of two (12.5 % resolution) from 1 us to about 70 min
+// fixed size, so adding never allocates, percentiles are upper bounds of buckets
+class LatencyHistogram
+{
+public:
+    void Add(double value) noexcept
+    {
+        ++buckets_[GetBucket(value)];
+        ++count_;
+        max_ = std::max(max_, value);
+    }
+
+    void Reset() noexcept
+    {
+        *this = LatencyHistogram();
+    }
+
+    size_t GetCount() const noexcept { return count_; }
+    double GetMax() const noexcept { return max_; }
+
+    // value which p (0 to 1) of added values do not exceed
+    double GetPercentile(double p) const noexcept
+    {
+        if (0 == count_)
+            return 0.;
+
+        const auto rank = std::max<uint64_t>(1, uint64_t(std::ceil(p * double(count_))));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < c_Buckets; ++i)
+        {
+            seen += buckets_[i];
+            if (seen >= rank)
+                return std::min(GetUpperBound(i), max_);
+        }
+        return max_;
+    }
+
+    // one line like "total: 120 x p50 8210 us, p95 15020 us, p99 16400 us, max 16650 us"
+    std::string Format(const char* name) const
+    {
+        char buffer[160] = {};
+        std::snprintf(buffer, sizeof(buffer), "%s: %zu x p50 %.0f us, p95 %.0f us, p99 %.0f us, max %.0f us",
+            name, count_, GetPercentile(0.5), GetPercentile(0.95), GetPercentile(0.99), max_);
+        return buffer;
+    }
+
+private:
+    static constexpr size_t c_SubBuckets = 8;
+    static constexpr size_t c_Buckets = c_SubBuckets * 32;
+
+    // bucket i covers [2^e * (1 + s / 8), 2^e * (1 + (s + 1) / 8)) us where e = i / 8 and s = i % 8, below 1 us goes to first
+    static size_t GetBucket(double value) noexcept
+    {
+        if (!(value >= 1.))
+            return 0;
+
+        int exponent = 0;
+        const auto mantissa = std::frexp(value, &exponent); // value = mantissa * 2^exponent, mantissa in [0.5, 1)
+        const auto bucket = size_t(exponent - 1) * c_SubBuckets + size_t((mantissa * 2. - 1.) * c_SubBuckets);
+        return std::min(bucket, c_Buckets - 1);
+    }
+
+    static double GetUpperBound(size_t bucket) noexcept
+    {
+        return std::ldexp(1. + double(bucket % c_SubBuckets + 1) / c_SubBuckets, int(bucket / c_SubBuckets));
+    }
+
+    std::array<uint64_t, c_Buckets> buckets_{};
+    size_t count_{};
+    double max_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// logic thread side, used under lock which guards simulation and publishing of frames
+// several inputs applied before frame is published are one sample, stamped with earliest of them
+class InputStamper
+{
+public:
+    // tick applied inputs, earliest of them was received at received
+    void Applied(TLoopClock::time_point received, TLoopClock::time_point now) noexcept
+    {
+        if (pending_)
+            return;
+
+        stamp_.received = received;
+        stamp_.applied = now;
+        pending_ = true;
+    }
+
+    // frame being published shows latest input, frames published later keep same stamp
+    void Stamp(FrameSnapshot& frame, TLoopClock::time_point now) noexcept
+    {
+        if (pending_)
+        {
+            stamp_.published = now;
+            ++stamp_.serial;
+            pending_ = false;
+        }
+        frame.input = stamp_;
+    }
+
+private:
+    InputStamp stamp_;
+    bool pending_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// window thread side, histograms of input to display latency by stages
+// frames may be skipped by painting, then input of skipped frame is not measured
+class InputLatency
+{
+public:
+    enum eStage
+    {
+        queued,    // received - applied, waiting in queue for tick
+        tick,      // applied - published, rest of tick and capture of frame
+        paintWait, // published - paint start, waiting for window thread
+        paint,     // paint start - presented, drawing and copy to window
+        total,     // received - presented
+        stageCount
+    };
+
+    // frame showing input was presented, paint of it started at paintStart
+    void Add(const InputStamp& input, TLoopClock::time_point paintStart, TLoopClock::time_point presented) noexcept
+    {
+        if (0 == input.serial || input.serial == lastSerial_)
+            return;
+        lastSerial_ = input.serial;
+
+        stages_[queued].Add(ToMicroseconds(input.applied - input.received));
+        stages_[tick].Add(ToMicroseconds(input.published - input.applied));
+        stages_[paintWait].Add(ToMicroseconds(paintStart - input.published));
+        stages_[paint].Add(ToMicroseconds(presented - paintStart));
+        stages_[total].Add(ToMicroseconds(presented - input.received));
+    }
+
+    const LatencyHistogram& GetStage(eStage stage) const noexcept
+    {
+        return stages_[stage];
+    }
+
+    // one line per stage
+    std::string Format() const
+    {
+        static const char* const names[stageCount] = { "queued", "tick", "paint wait", "paint", "total" };
+
+        std::string res;
+        for (size_t i = 0; i < stageCount; ++i)
+            res += stages_[i].Format(names[i]) + "\n";
+        return res;
+    }
+
+    // writes Format to file, false when file cannot be written
+    bool Dump(const char* path) const
+    {
+        std::ofstream file(path);
+        file << Format();
+        file.close();
+        return !file.fail();
+    }
+
+private:
+    std::array<LatencyHistogram, stageCount> stages_;
+    uint64_t lastSerial_{};
+};
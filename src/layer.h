@@ -0,0 +1,76 @@
+#pragma once
+
+// static part of frames, playground with targets, is drawn once into framebuffer of window size
+// it changes only when targets are hit, so frames copy it and draw just information, player and ball over it
+
+#include "painter.h"
+#include "softrenderer.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// hit targets are cleared one by one with playground color (targets do not overlap),
+// whole layer is redrawn only after resize, layout change or when targets come back with new game
+class TargetLayer
+{
+public:
+    // brings layer to playground and targets of frame
+    void Update(FramePainter& painter, const FrameSnapshot& frame, int width, int height)
+    {
+        bool rebuild = !valid_
+            || layer_.GetWidth() != width
+            || layer_.GetHeight() != height
+            || !playground_.rect.Equals(frame.playground.rect)
+            || playground_.color.GetValue() != frame.playground.color.GetValue();
+
+        // same version has same targets, so layer is up to date
+        if (!rebuild && 0 != frame.targetsVersion && frame.targetsVersion == version_)
+            return;
+
+        if (!rebuild)
+        {
+            ProfileScope profile(eProfilePhase::layer);
+            SoftwareRenderer renderer(layer_);
+            rebuild = !ForEachRemovedTarget(targets_, frame.targets,
+                [&renderer, &frame](const ShapeSnapshot& target) { renderer.FillRectangle(target.rect, frame.playground.color); });
+        }
+
+        if (rebuild)
+        {
+            layer_.Resize(width, height);
+            SoftwareRenderer renderer(layer_);
+            painter.DrawLayer(&renderer, frame, nullptr);
+            ++rebuilds_;
+        }
+
+        // keeps capacity, so copy does not allocate once it is big enough
+        playground_ = frame.playground;
+        targets_ = frame.targets;
+        version_ = frame.targetsVersion;
+        valid_ = true;
+    }
+
+    // frame inside clip: layer with moving part of frame drawn over it, layer has to be updated to frame before
+    void Draw(SoftwareRenderer& renderer, FramePainter& painter, const FrameSnapshot& frame, std::chrono::steady_clock::time_point now,
+        FrameArena& arena, const RectF& clip) const
+    {
+        renderer.SetClip(&clip);
+        {
+            ProfileScope profile(eProfilePhase::layerCopy);
+            renderer.CopyPixels(layer_);
+        }
+        painter.DrawOverLayer(&renderer, frame, now, arena, &clip);
+        renderer.SetClip(nullptr);
+    }
+
+    size_t GetRebuilds() const noexcept
+    {
+        return rebuilds_;
+    }
+
+private:
+    Framebuffer layer_;
+    ShapeSnapshot playground_;
+    std::vector<ShapeSnapshot> targets_; // targets drawn in layer
+    uint64_t version_{}; // of targets
+    size_t rebuilds_{};
+    bool valid_{};
+};
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "frame.h"
+#include "renderer.h"
+#include "arena.h"
+#include "drawlist.h"
+#include "profiler.h"
+
+constexpr LPCWSTR c_strPaused = L"Paused";
+constexpr LPCWSTR c_strScore = L"Score: ";
+constexpr LPCWSTR c_strWin = L"Congratulations - You won the game!";
+constexpr LPCWSTR c_strFail = L"You failed the game!";
+constexpr LPCWSTR c_strControls = L"Space - Pause, Enter - New game, Esc - Quit";
+constexpr LPCWSTR c_strLives = L"Lives left:";
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// draws frame snapshot through renderer, uses nothing but the snapshot
+// keeps targets of last frame drawn grouped by color, so they are drawn with one command per color,
+// and HUD text laid out, so text is laid out again only when it changes
+class FramePainter
+{
+public:
+    // now is time of paint, ball is interpolated for it
+    // scratch data is taken from arena, caller resets it after frame is presented
+    void Draw(IRenderer* renderer, const FrameSnapshot& frame, std::chrono::steady_clock::time_point now, FrameArena& arena)
+    {
+        DrawLayer(renderer, frame, nullptr);
+        DrawOverLayer(renderer, frame, now, arena, nullptr);
+    }
+
+    // redraws only pixels inside clip, shapes outside of it are skipped
+    void Draw(IRenderer* renderer, const FrameSnapshot& frame, std::chrono::steady_clock::time_point now, FrameArena& arena,
+        const RectF& clip)
+    {
+        renderer->SetClip(&clip);
+        DrawLayer(renderer, frame, &clip);
+        DrawOverLayer(renderer, frame, now, arena, &clip);
+        renderer->SetClip(nullptr);
+    }
+
+    // static part of frame, playground with targets, it changes only when targets are hit
+    // clip (if any) has to be set on renderer by caller, shapes outside of it are skipped
+    void DrawLayer(IRenderer* renderer, const FrameSnapshot& frame, const RectF* clip)
+    {
+        ProfileScope profile(eProfilePhase::layer);
+
+        if (IsVisible(frame.playground.rect, clip))
+            renderer->FillRectangle(frame.playground.rect, frame.playground.color);
+
+        // renderer skips parts of batch outside of clip
+        targets_.Update(frame.targets, frame.targetsVersion);
+        for (const auto& batch : targets_.GetBatches())
+        {
+            if (!batch.rects.empty())
+                renderer->FillRectangles(batch.rects.data(), batch.rects.size(), batch.color);
+        }
+    }
+
+    // moving part of frame, information, player and ball, drawn over static part
+    void DrawOverLayer(IRenderer* renderer, const FrameSnapshot& frame, std::chrono::steady_clock::time_point now,
+        FrameArena& arena, const RectF* clip)
+    {
+        if (IsVisible(frame.info.rect, clip))
+        {
+            ProfileScope profile(eProfilePhase::information);
+            DrawInformation(renderer, frame.info, arena);
+        }
+
+        ProfileScope profile(eProfilePhase::shapes);
+
+        if (IsVisible(frame.player.rect, clip))
+            renderer->FillRectangle(frame.player.rect, frame.player.color);
+
+        // edge of ellipse is blended into pixels partly outside of its bounds
+        const auto ball = frame.GetBallBounds(now);
+        if (IsVisible(RectF(ball.X - 1.f, ball.Y - 1.f, ball.Width + 2.f, ball.Height + 2.f), clip))
+            renderer->FillEllipse(ball, frame.ball.color);
+    }
+
+    // lines drawn in information area instead of HUD text while there are any, up to c_OverlayLines
+    void SetOverlay(std::vector<std::wstring> lines)
+    {
+        overlay_ = std::move(lines);
+        ++overlayVersion_;
+    }
+
+    // HUD text is laid out again on next draw, runs keep their storage
+    void InvalidateText() noexcept
+    {
+        for (auto cached : { &pausedText_, &scoreText_, &resultText_, &controlsText_, &livesText_ })
+            cached->valid = false;
+        for (auto& cached : overlayText_)
+            cached.valid = false;
+    }
+
+    const TargetDrawList& GetTargetDrawList() const noexcept
+    {
+        return targets_;
+    }
+
+    // how many times HUD text was laid out
+    size_t GetTextLayouts() const noexcept
+    {
+        return textLayouts_;
+    }
+
+private:
+    static bool IsVisible(const RectF& rect, const RectF* clip) noexcept
+    {
+        return nullptr == clip || clip->IntersectsWith(rect);
+    }
+
+    // prefix followed by decimal value, string lives in arena
+    static LPCWSTR FormatNumber(FrameArena& arena, LPCWSTR prefix, size_t value)
+    {
+        wchar_t digits[24];
+        size_t digitsCount = 0;
+        do
+        {
+            digits[digitsCount++] = wchar_t(L'0' + value % 10);
+            value /= 10;
+        } while (0 != value);
+
+        const auto prefixLength = std::char_traits<wchar_t>::length(prefix);
+
+        auto res = arena.AllocateArray<wchar_t>(prefixLength + digitsCount + 1);
+        std::copy(prefix, prefix + prefixLength, res);
+        std::reverse_copy(digits, digits + digitsCount, res + prefixLength);
+        res[prefixLength + digitsCount] = 0;
+        return res;
+    }
+
+    // HUD text laid out once, again only when its value or place changes
+    struct CachedText
+    {
+        GlyphRun run;
+        size_t value{};
+        bool valid{};
+    };
+
+    // text is called for string to lay out only when run has to be laid out again
+    template <typename TText>
+    const GlyphRun& GetText(IRenderer* renderer, CachedText& cached, eFont font, const PointF& origin, size_t value, TText&& text)
+    {
+        if (!cached.valid || cached.value != value || cached.run.origin.X != origin.X || cached.run.origin.Y != origin.Y)
+        {
+            renderer->LayoutGlyphRun(text(), font, origin, cached.run);
+            cached.value = value;
+            cached.valid = true;
+            ++textLayouts_;
+        }
+
+        return cached.run;
+    }
+
+    void DrawInformation(IRenderer* renderer, const InfoSnapshot& info, FrameArena& arena)
+    {
+        renderer->FillRectangle(info.rect, info.color);
+
+        if (!overlay_.empty())
+        {
+            DrawOverlay(renderer, info);
+            return;
+        }
+
+        DrawPause(renderer, info);
+        DrawScore(renderer, info, arena);
+        DrawResult(renderer, info);
+        DrawControls(renderer, info);
+        DrawLives(renderer, info);
+    }
+
+    void DrawOverlay(IRenderer* renderer, const InfoSnapshot& info)
+    {
+        for (size_t i = 0; i < overlay_.size() && i < c_OverlayLines; ++i)
+        {
+            const auto& run = GetText(renderer, overlayText_[i], eFont::hint, PointF(info.rect.X + 5.f, info.rect.Y + 5.f + 20.f * float(i)),
+                overlayVersion_, [this, i]() { return overlay_[i].c_str(); });
+            renderer->DrawGlyphRun(run, Color::White);
+        }
+    }
+
+    void DrawPause(IRenderer* renderer, const InfoSnapshot& info)
+    {
+        if (!info.paused)
+            return;
+
+        const auto& run = GetText(renderer, pausedText_, eFont::text, PointF(info.rect.X + 5, info.rect.Y + 5), 0,
+            []() { return c_strPaused; });
+        renderer->DrawGlyphRun(run, Color::Yellow);
+    }
+
+    void DrawScore(IRenderer* renderer, const InfoSnapshot& info, FrameArena& arena)
+    {
+        const auto& run = GetText(renderer, scoreText_, eFont::text, PointF(info.rect.X + info.rect.Width / 3.f, info.rect.Y + 5.f), info.score,
+            [&arena, &info]() { return FormatNumber(arena, c_strScore, info.score); });
+        renderer->DrawGlyphRun(run, Color::Yellow);
+    }
+
+    void DrawResult(IRenderer* renderer, const InfoSnapshot& info)
+    {
+        if (!info.victory && !info.fail)
+            return;
+
+        const auto& run = GetText(renderer, resultText_, eFont::text, PointF(info.rect.X + 5.f, info.rect.Y + 25.f), info.victory ? 1 : 0,
+            [&info]() { return info.victory ? c_strWin : c_strFail; });
+        renderer->DrawGlyphRun(run, info.victory ? Color::Green : Color::Red);
+    }
+
+    void DrawControls(IRenderer* renderer, const InfoSnapshot& info)
+    {
+        const auto& run = GetText(renderer, controlsText_, eFont::hint, PointF(info.rect.X + 5, info.rect.Y + 45.f), 0,
+            []() { return c_strControls; });
+        renderer->DrawGlyphRun(run, Color::White);
+    }
+
+    void DrawLives(IRenderer* renderer, const InfoSnapshot& info)
+    {
+        const auto& run = GetText(renderer, livesText_, eFont::text, PointF(info.rect.X + info.rect.Width / 1.5f, info.rect.Y + 5.f), 0,
+            []() { return c_strLives; });
+        renderer->DrawGlyphRun(run, Color::Yellow);
+
+        if (info.lives > 0)
+        {
+            RectF rect;
+            rect.X = run.bounds.X + run.bounds.Width + 5;
+            rect.Y = run.bounds.Y;
+            rect.Width = 14.f;
+            rect.Height = 14.f;
+
+            for (size_t i = 0; i < info.lives; ++i)
+            {
+                renderer->FillEllipse(rect, Color::Red);
+                rect.X += 20;
+            }
+        }
+    }
+
+    TargetDrawList targets_;
+    CachedText pausedText_;
+    CachedText scoreText_;
+    CachedText resultText_;
+    CachedText controlsText_;
+    CachedText livesText_;
+
+    static constexpr size_t c_OverlayLines = 3;
+    std::vector<std::wstring> overlay_;
+    size_t overlayVersion_{};
+    std::array<CachedText, c_OverlayLines> overlayText_;
+    size_t textLayouts_{};
+};
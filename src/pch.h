@@ -8,6 +8,7 @@
 #define PCH_H
 
 // add headers that you want to pre-compile here
+#ifdef _WIN32
 #include "framework.h"
 
 #include <objidl.h>
@@ -18,6 +19,9 @@ using std::min;
 using std::max;
 #include <gdiplus.h>
 #pragma warning(pop)
+#else
+#include "portable.h"
+#endif
 
 using namespace Gdiplus;
 
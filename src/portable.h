@@ -0,0 +1,156 @@
+#pragma once
+
+// Subset of GDI+ value types used by the game model.
+// Lets the simulation build without Windows (see headless.cpp), on Windows the real GDI+ types are used.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <cmath>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <memory>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+using LPCWSTR = const wchar_t*;
+
+namespace Gdiplus
+{
+    using REAL = float;
+    using ARGB = uint32_t;
+    using BYTE = uint8_t;
+
+    class PointF
+    {
+    public:
+        PointF() noexcept = default;
+        PointF(REAL x, REAL y) noexcept
+            : X(x)
+            , Y(y)
+        {
+        }
+
+        REAL X{};
+        REAL Y{};
+    };
+
+    class SizeF
+    {
+    public:
+        SizeF() noexcept = default;
+        SizeF(REAL width, REAL height) noexcept
+            : Width(width)
+            , Height(height)
+        {
+        }
+
+        REAL Width{};
+        REAL Height{};
+    };
+
+    class RectF
+    {
+    public:
+        RectF() noexcept = default;
+        RectF(REAL x, REAL y, REAL width, REAL height) noexcept
+            : X(x)
+            , Y(y)
+            , Width(width)
+            , Height(height)
+        {
+        }
+
+        REAL GetLeft() const noexcept { return X; }
+        REAL GetTop() const noexcept { return Y; }
+        REAL GetRight() const noexcept { return X + Width; }
+        REAL GetBottom() const noexcept { return Y + Height; }
+
+        bool IsEmptyArea() const noexcept
+        {
+            return (Width <= 0.f) || (Height <= 0.f);
+        }
+
+        // same strict comparison as GDI+, zero sized edges still intersect
+        bool IntersectsWith(const RectF& rect) const noexcept
+        {
+            return (GetLeft() < rect.GetRight()
+                && GetTop() < rect.GetBottom()
+                && GetRight() > rect.GetLeft()
+                && GetBottom() > rect.GetTop());
+        }
+
+        static bool Union(RectF& c, const RectF& a, const RectF& b) noexcept
+        {
+            const REAL right = std::max(a.GetRight(), b.GetRight());
+            const REAL bottom = std::max(a.GetBottom(), b.GetBottom());
+            c.X = std::min(a.X, b.X);
+            c.Y = std::min(a.Y, b.Y);
+            c.Width = right - c.X;
+            c.Height = bottom - c.Y;
+            return !c.IsEmptyArea();
+        }
+
+        static bool Intersect(RectF& c, const RectF& a, const RectF& b) noexcept
+        {
+            const REAL right = std::min(a.GetRight(), b.GetRight());
+            const REAL bottom = std::min(a.GetBottom(), b.GetBottom());
+            c.X = std::max(a.X, b.X);
+            c.Y = std::max(a.Y, b.Y);
+            c.Width = right - c.X;
+            c.Height = bottom - c.Y;
+            return !c.IsEmptyArea();
+        }
+
+        bool Equals(const RectF& rect) const noexcept
+        {
+            return X == rect.X && Y == rect.Y && Width == rect.Width && Height == rect.Height;
+        }
+
+        REAL X{};
+        REAL Y{};
+        REAL Width{};
+        REAL Height{};
+    };
+
+    class Color
+    {
+    public:
+        enum : ARGB
+        {
+            Black = 0xFF000000,
+            DarkBlue = 0xFF00008B,
+            Green = 0xFF008000,
+            Orange = 0xFFFFA500,
+            Red = 0xFFFF0000,
+            White = 0xFFFFFFFF,
+            Yellow = 0xFFFFFF00,
+        };
+
+        Color() noexcept = default;
+        Color(ARGB argb) noexcept
+            : Argb(argb)
+        {
+        }
+        Color(BYTE a, BYTE r, BYTE g, BYTE b) noexcept
+            : Argb((ARGB(a) << 24) | (ARGB(r) << 16) | (ARGB(g) << 8) | ARGB(b))
+        {
+        }
+
+        BYTE GetA() const noexcept { return BYTE(Argb >> 24); }
+        BYTE GetR() const noexcept { return BYTE(Argb >> 16); }
+        BYTE GetG() const noexcept { return BYTE(Argb >> 8); }
+        BYTE GetB() const noexcept { return BYTE(Argb); }
+        ARGB GetValue() const noexcept { return Argb; }
+
+    private:
+        ARGB Argb = Black;
+    };
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+// scoped timers around hot phases of tick and frame, samples go to fixed size ring of each phase
+// phase is timed by one thread at a time (tick phases by logic thread, frame phases by window thread),
+// any thread reads rings, sample overwritten while it is read may mix two samples, which is fine for profiling
+// disabled timer costs one relaxed atomic load
+
+#include <algorithm>
+#include <array>
+#include <cwchar>
+#include <fstream>
+
+enum class eProfilePhase
+{
+    gameLogic,   // GameSimulation::ProcessGameLogic, whole tick
+    ballHits,    // GameSimulation::ProcessBallHits
+    targetHit,   // Targets::GetTargetHitWithBall
+    layer,       // playground with targets, FramePainter::DrawLayer
+    layerCopy,   // target layer copied to framebuffer
+    information, // information area
+    shapes,      // player and ball
+    present,     // framebuffer or bitmap copied to window
+    count
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+class Profiler
+{
+public:
+    static constexpr size_t c_Samples = 1024; // per phase, power of two
+    static constexpr size_t c_Phases = size_t(eProfilePhase::count);
+
+    struct Summary
+    {
+        size_t count{};
+        double mean{}; // us
+        double max{};  // us
+    };
+
+    void SetEnabled(bool enabled) noexcept
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool IsEnabled() const noexcept
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void Add(eProfilePhase phase, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) noexcept
+    {
+        auto& ring = rings_[size_t(phase)];
+        const auto next = ring.next.load(std::memory_order_relaxed);
+        auto& slot = ring.slots[next & (c_Samples - 1)];
+        slot.start.store(start.time_since_epoch().count(), std::memory_order_relaxed);
+        slot.duration.store((end - start).count(), std::memory_order_relaxed);
+        ring.next.store(next + 1, std::memory_order_release);
+    }
+
+    // samples of phase which started within period before now
+    Summary GetSummary(eProfilePhase phase, std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration period) const noexcept
+    {
+        Summary res;
+        double sum = 0.;
+        const auto from = (now - period).time_since_epoch().count();
+        ForEachSample(phase, [&](int64_t start, int64_t duration)
+            {
+                if (start < from)
+                    return;
+
+                const auto value = ToMicroseconds(duration);
+                ++res.count;
+                sum += value;
+                res.max = std::max(res.max, value);
+            });
+        res.mean = res.count ? sum / double(res.count) : 0.;
+        return res;
+    }
+
+    // lines like "logic 1.2/4.0  hits 0.3/0.9  target 0.1/0.4", mean/max in us of samples within period before now
+    std::vector<std::wstring> Format(std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration period,
+        size_t phasesPerLine) const
+    {
+        std::vector<std::wstring> res;
+        for (size_t i = 0; i < c_Phases; ++i)
+        {
+            const auto summary = GetSummary(eProfilePhase(i), now, period);
+
+            wchar_t buffer[64] = {};
+            std::swprintf(buffer, 64, L"%ls %.1f/%.1f", c_Names[i], summary.mean, summary.max);
+
+            if (0 == i % phasesPerLine)
+                res.emplace_back();
+            else
+                res.back() += L"  ";
+            res.back() += buffer;
+        }
+        return res;
+    }
+
+    // all samples in rings ordered by start, rows "phase,start_us,duration_us", start is relative to first sample
+    bool ExportCsv(const char* path) const
+    {
+        struct Row
+        {
+            size_t phase;
+            int64_t start;
+            int64_t duration;
+        };
+
+        std::vector<Row> rows;
+        for (size_t i = 0; i < c_Phases; ++i)
+        {
+            ForEachSample(eProfilePhase(i), [&rows, i](int64_t start, int64_t duration)
+                {
+                    rows.push_back({ i, start, duration });
+                });
+        }
+        std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.start < b.start; });
+
+        std::ofstream file(path);
+        file << "phase,start_us,duration_us\n";
+        for (const auto& row : rows)
+        {
+            char buffer[96] = {};
+            std::snprintf(buffer, sizeof(buffer), "%ls,%.3f,%.3f\n", c_Names[row.phase],
+                ToMicroseconds(row.start - rows.front().start), ToMicroseconds(row.duration));
+            file << buffer;
+        }
+        file.close();
+        return !file.fail();
+    }
+
+private:
+    static constexpr const wchar_t* c_Names[c_Phases] = { L"logic", L"hits", L"target", L"layer", L"copy", L"info", L"shapes", L"present" };
+
+    static double ToMicroseconds(int64_t ticks) noexcept
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::duration(ticks)).count();
+    }
+
+    template <typename TSample>
+    void ForEachSample(eProfilePhase phase, TSample&& sample) const
+    {
+        const auto& ring = rings_[size_t(phase)];
+        const auto next = ring.next.load(std::memory_order_acquire);
+        for (size_t i = next > c_Samples ? next - c_Samples : 0; i < next; ++i)
+        {
+            const auto& slot = ring.slots[i & (c_Samples - 1)];
+            sample(slot.start.load(std::memory_order_relaxed), slot.duration.load(std::memory_order_relaxed));
+        }
+    }
+
+    // clock ticks, atomics so that reading ring while phase is timed is no data race
+    struct Slot
+    {
+        std::atomic<int64_t> start{};
+        std::atomic<int64_t> duration{};
+    };
+
+    struct Ring
+    {
+        alignas(64) std::atomic<size_t> next{}; // only grows
+        std::array<Slot, c_Samples> slots;
+    };
+
+    std::atomic_bool enabled_{};
+    std::array<Ring, c_Phases> rings_;
+};
+
+// one for process, game window has one game
+inline Profiler g_Profiler;
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// times its scope as phase when profiler is enabled
+class ProfileScope
+{
+public:
+    explicit ProfileScope(eProfilePhase phase) noexcept
+        : phase_(phase)
+        , enabled_(g_Profiler.IsEnabled())
+    {
+        if (enabled_)
+            start_ = std::chrono::steady_clock::now();
+    }
+
+    ~ProfileScope()
+    {
+        if (enabled_)
+            g_Profiler.Add(phase_, start_, std::chrono::steady_clock::now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    eProfilePhase phase_;
+    bool enabled_;
+    std::chrono::steady_clock::time_point start_;
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+// PCG32 generator (pcg-random.org): 64 bit state, small and fast, no shared state
+// each game owns one seeded from its seed, so game plays same from same seed on any thread
+
+class Random
+{
+public:
+    explicit Random(uint64_t seed = 0) noexcept
+    {
+        Seed(seed);
+    }
+
+    void Seed(uint64_t seed) noexcept
+    {
+        state_ = 0;
+        Next();
+        state_ += seed;
+        Next();
+    }
+
+    uint32_t Next() noexcept
+    {
+        const auto old = state_;
+        state_ = old * 6364136223846793005ull + c_Increment;
+        const auto xorShifted = uint32_t(((old >> 18u) ^ old) >> 27u);
+        const auto rotation = uint32_t(old >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+    }
+
+    // uniform in [0, bound), bound > 0, multiply and reject instead of modulo, so there is no bias
+    uint32_t Next(uint32_t bound) noexcept
+    {
+        auto product = uint64_t(Next()) * bound;
+        if (uint32_t(product) < bound)
+        {
+            const auto threshold = (0u - bound) % bound;
+            while (uint32_t(product) < threshold)
+                product = uint64_t(Next()) * bound;
+        }
+        return uint32_t(product >> 32u);
+    }
+
+    // whole state of generator, for saved games
+    uint64_t GetState() const noexcept { return state_; }
+    void SetState(uint64_t state) noexcept { state_ = state; }
+
+    uint64_t Next64() noexcept
+    {
+        const uint64_t high = Next();
+        return (high << 32u) | Next();
+    }
+
+private:
+    static constexpr uint64_t c_Increment = 1442695040888963407ull; // stream, has to be odd
+
+    uint64_t state_{};
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+// platform neutral drawing interface, frames are painted only through it
+
+enum class eFont
+{
+    text, // 14 pixels
+    hint, // 12 pixels
+};
+
+// text laid out by renderer once and drawn until it changes
+// glyphs are filled by backends which draw glyphs themselves, others draw text at origin
+struct GlyphRun
+{
+    static constexpr size_t c_MaxLength = 64;
+
+    struct Glyph
+    {
+        wchar_t ch;
+        int left; // top left of glyph bitmap, pixels
+        int top;
+    };
+
+    // keeps text (cut to c_MaxLength), font and origin, clears glyphs
+    void Reset(LPCWSTR newText, eFont newFont, const PointF& newOrigin) noexcept
+    {
+        length = 0;
+        while (length < c_MaxLength && 0 != newText[length])
+        {
+            text[length] = newText[length];
+            ++length;
+        }
+        text[length] = 0;
+
+        font = newFont;
+        origin = newOrigin;
+        bounds = RectF(origin.X, origin.Y, 0.f, 0.f);
+        glyphCount = 0;
+    }
+
+    wchar_t text[c_MaxLength + 1]{};
+    size_t length{};
+    eFont font{};
+    PointF origin;
+    RectF bounds;
+    Glyph glyphs[c_MaxLength]{};
+    size_t glyphCount{};
+};
+
+struct IRenderer
+{
+    // limits drawing to rect until next call, nullptr removes the limit
+    virtual void SetClip(const RectF* rect) = 0;
+
+    virtual void FillRectangle(const RectF& rect, const Color& color) = 0;
+    virtual void FillRectangles(const RectF* rects, size_t count, const Color& color) = 0;
+    virtual void FillEllipse(const RectF& rect, const Color& color) = 0;
+
+    // lays out text with top left corner at origin into run, sets its bounds
+    virtual void LayoutGlyphRun(LPCWSTR text, eFont font, const PointF& origin, GlyphRun& run) = 0;
+    virtual void DrawGlyphRun(const GlyphRun& run, const Color& color) = 0;
+};
@@ -0,0 +1,617 @@
+#pragma once
+
+// games recorded as seed and inputs with ticks they were applied on, replayed as fast as machine goes
+// file:
+//   header - "BRKR", version (uint16), seed of first game (uint64), world width and height (float)
+//   events - ticks since previous event (varint), code (byte), data of code:
+//            resize - width and height (float), end - state hash (uint64), score, lives (varint),
+//            state - size (varint) and bytes of GameSimulation::SaveState,
+//            keyframe - state hash (uint64), world width and height (float), state as state event (world and state from version 3)
+//   index  - count of keyframes (varint), tick and file offset of each keyframe event (varint)
+//   offset of index (uint64), last 8 bytes of file
+// numbers are little endian, varint is 7 bits per byte, low bits first, high bit set on all bytes but last
+// state hashes are GetStateHash of fixed width values from version 4, so recording is checked same on all platforms
+
+#include "inputqueue.h"
+
+#include <cstring>
+#include <fstream>
+
+enum class eReplayCode : uint8_t
+{
+    left,
+    right,
+    pause,
+    newGame,
+    resize,   // world rect changed
+    keyframe, // state before inputs of tick and its hash, keyframes are indexed, so replay can start from them
+    end,      // state hash, score and lives when recording stopped
+    state,    // game was set to state, e.g. by rewind (version 2)
+};
+
+struct ReplayEvent
+{
+    uint64_t tick{};
+    eReplayCode code{};
+    float width{};  // resize, keyframe
+    float height{}; // resize, keyframe
+    uint64_t hash{}; // keyframe, end
+    uint64_t score{}; // end
+    uint64_t lives{}; // end
+    size_t stateOffset{}; // state, keyframe, bytes are in data event was read from
+    size_t stateSize{}; // state, keyframe
+};
+
+struct ReplayKeyframe
+{
+    uint64_t tick{};
+    uint64_t offset{}; // of keyframe event in file
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+namespace ReplayFormat
+{
+    constexpr char c_Magic[4] = { 'B', 'R', 'K', 'R' };
+    // versions 1 - 3 are read too, 1 has no state events, keyframes of 1 and 2 have hash only,
+    // hashes before 4 were of platform dependent bytes, so they are not compared
+    constexpr uint16_t c_Version = 4;
+    constexpr uint16_t c_FixedHashVersion = 4;
+    constexpr size_t c_HeaderSize = 4 + 2 + 8 + 4 + 4;
+
+    inline void PutFixed(std::string& out, uint64_t value, size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; ++i)
+            out.push_back(char((value >> (8 * i)) & 0xff));
+    }
+
+    inline void PutFloat(std::string& out, float value)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        PutFixed(out, bits, 4);
+    }
+
+    inline void PutVarint(std::string& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(char((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(char(value));
+    }
+
+    // readers return false when data ends too soon, position is moved past value
+    inline bool GetFixed(const std::string& in, size_t& pos, size_t bytes, uint64_t& value)
+    {
+        if (in.size() - pos < bytes || pos > in.size())
+            return false;
+
+        value = 0;
+        for (size_t i = 0; i < bytes; ++i)
+            value |= uint64_t(uint8_t(in[pos + i])) << (8 * i);
+        pos += bytes;
+        return true;
+    }
+
+    inline bool GetFloat(const std::string& in, size_t& pos, float& value)
+    {
+        uint64_t bits = 0;
+        if (!GetFixed(in, pos, 4, bits))
+            return false;
+
+        const auto bits32 = uint32_t(bits);
+        std::memcpy(&value, &bits32, sizeof(value));
+        return true;
+    }
+
+    inline bool GetVarint(const std::string& in, size_t& pos, uint64_t& value)
+    {
+        value = 0;
+        for (unsigned shift = 0; pos < in.size() && shift < 64; shift += 7)
+        {
+            const auto byte = uint8_t(in[pos++]);
+            value |= uint64_t(byte & 0x7f) << shift;
+            if (0 == (byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    inline void PutState(std::string& out, const std::vector<uint8_t>& state)
+    {
+        PutVarint(out, state.size());
+        out.append(reinterpret_cast<const char*>(state.data()), state.size());
+    }
+
+    inline bool GetState(const std::string& in, size_t& pos, ReplayEvent& event)
+    {
+        uint64_t size = 0;
+        if (!GetVarint(in, pos, size) || in.size() - pos < size)
+            return false;
+
+        event.stateOffset = pos;
+        event.stateSize = size_t(size);
+        pos += event.stateSize;
+        return true;
+    }
+
+    // event tick is previous tick plus delta stored, state and keyframe events take their bytes from state
+    inline void PutEvent(std::string& out, const ReplayEvent& event, uint64_t previousTick, const std::vector<uint8_t>* state = nullptr)
+    {
+        PutVarint(out, event.tick - previousTick);
+        out.push_back(char(event.code));
+
+        switch (event.code)
+        {
+        case eReplayCode::resize:
+            PutFloat(out, event.width);
+            PutFloat(out, event.height);
+            break;
+        case eReplayCode::keyframe:
+            PutFixed(out, event.hash, 8);
+            PutFloat(out, event.width);
+            PutFloat(out, event.height);
+            PutState(out, *state);
+            break;
+        case eReplayCode::end:
+            PutFixed(out, event.hash, 8);
+            PutVarint(out, event.score);
+            PutVarint(out, event.lives);
+            break;
+        case eReplayCode::state:
+            PutState(out, *state);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // version is that of recording data comes from
+    inline bool GetEvent(const std::string& in, size_t& pos, uint64_t previousTick, ReplayEvent& event, uint64_t version = c_Version)
+    {
+        uint64_t delta = 0;
+        if (!GetVarint(in, pos, delta) || pos >= in.size())
+            return false;
+
+        event = ReplayEvent();
+        event.tick = previousTick + delta;
+        event.code = eReplayCode(in[pos++]);
+
+        switch (event.code)
+        {
+        case eReplayCode::left:
+        case eReplayCode::right:
+        case eReplayCode::pause:
+        case eReplayCode::newGame:
+            return true;
+        case eReplayCode::resize:
+            return GetFloat(in, pos, event.width) && GetFloat(in, pos, event.height);
+        case eReplayCode::keyframe:
+            if (!GetFixed(in, pos, 8, event.hash))
+                return false;
+            return version < 3 || (GetFloat(in, pos, event.width) && GetFloat(in, pos, event.height) && GetState(in, pos, event));
+        case eReplayCode::end:
+            return GetFixed(in, pos, 8, event.hash) && GetVarint(in, pos, event.score) && GetVarint(in, pos, event.lives);
+        case eReplayCode::state:
+            return GetState(in, pos, event);
+        default:
+            return false;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// thread which applies inputs records them, events go through lock-free queue to writer thread, which encodes and writes them
+// resize may be recorded by other thread when both hold same lock, as game window does
+class ReplayRecorder
+{
+public:
+    static constexpr uint64_t c_KeyframeTicks = 1000;
+
+    ~ReplayRecorder()
+    {
+        if (writer_.joinable())
+        {
+            stopping_.store(true, std::memory_order_release);
+            writer_.join();
+        }
+    }
+
+    // game has to be in state it starts replay from: seed of first game given, world set, first game not started yet
+    // or started by NewGame right before
+    bool Start(const char* path, uint64_t seed, const RectF& world)
+    {
+        file_.open(path, std::ios::binary | std::ios::trunc);
+        if (!file_)
+            return false;
+
+        std::string header(ReplayFormat::c_Magic, sizeof(ReplayFormat::c_Magic));
+        ReplayFormat::PutFixed(header, ReplayFormat::c_Version, 2);
+        ReplayFormat::PutFixed(header, seed, 8);
+        ReplayFormat::PutFloat(header, world.Width);
+        ReplayFormat::PutFloat(header, world.Height);
+        file_.write(header.data(), std::streamsize(header.size()));
+        offset_ = header.size();
+
+        recording_ = true;
+        nextKeyframe_ = 0;
+        stopping_.store(false, std::memory_order_relaxed);
+        writer_ = std::thread(&ReplayRecorder::Write, this);
+        return true;
+    }
+
+    bool IsRecording() const noexcept
+    {
+        return recording_;
+    }
+
+    // keyframe is due every c_KeyframeTicks, it has to be taken before inputs of tick are applied
+    bool IsKeyframeDue(uint64_t tick) const noexcept
+    {
+        return recording_ && tick >= nextKeyframe_;
+    }
+
+    // state of game goes into recording with its hash and world, so replay read from file can start from it
+    void Keyframe(const GameSimulation& game)
+    {
+        // state vector keeps capacity, so keyframes do not allocate after first one
+        game.SaveState(keyframeState_);
+        while (!states_.Push(keyframeState_))
+            std::this_thread::yield();
+
+        ReplayEvent event;
+        event.tick = game.GetTick();
+        event.code = eReplayCode::keyframe;
+        event.hash = game.GetStateHash();
+        event.width = game.GetWorld().Width;
+        event.height = game.GetWorld().Height;
+        Push(event);
+        nextKeyframe_ = (event.tick / c_KeyframeTicks + 1) * c_KeyframeTicks;
+    }
+
+    // inputs applied on tick, before it was stepped, they go in order GameSimulation::ApplyInputs applies them
+    void Record(uint64_t tick, const GameInputs& inputs) noexcept
+    {
+        if (!recording_)
+            return;
+
+        ReplayEvent event;
+        event.tick = tick;
+
+        if (inputs.newGame)
+        {
+            event.code = eReplayCode::newGame;
+            Push(event);
+        }
+        if (inputs.togglePause)
+        {
+            event.code = eReplayCode::pause;
+            Push(event);
+        }
+
+        event.code = inputs.playerMoves < 0 ? eReplayCode::left : eReplayCode::right;
+        for (int i = 0; i < std::abs(inputs.playerMoves); ++i)
+            Push(event);
+    }
+
+    // game was set to state of GameSimulation::SaveState on tick, after inputs of tick
+    void State(uint64_t tick, const std::vector<uint8_t>& state)
+    {
+        if (!recording_)
+            return;
+
+        // state is in its queue before its event is in event queue
+        while (!states_.Push(state))
+            std::this_thread::yield();
+
+        ReplayEvent event;
+        event.tick = tick;
+        event.code = eReplayCode::state;
+        Push(event);
+    }
+
+    void Resize(uint64_t tick, const RectF& world) noexcept
+    {
+        if (!recording_)
+            return;
+
+        ReplayEvent event;
+        event.tick = tick;
+        event.code = eReplayCode::resize;
+        event.width = world.Width;
+        event.height = world.Height;
+        Push(event);
+    }
+
+    // ends recording with state game stopped in, writes index, false when file was not written whole
+    bool Stop(const GameSimulation& game)
+    {
+        if (!recording_)
+            return false;
+
+        ReplayEvent event;
+        event.tick = game.GetTick();
+        event.code = eReplayCode::end;
+        event.hash = game.GetStateHash();
+        event.score = game.GetGameInformation()->GetScore();
+        event.lives = game.GetGameInformation()->GetLives();
+        Push(event);
+
+        stopping_.store(true, std::memory_order_release);
+        writer_.join();
+        recording_ = false;
+
+        std::string index;
+        ReplayFormat::PutVarint(index, index_.size());
+        for (const auto& keyframe : index_)
+        {
+            ReplayFormat::PutVarint(index, keyframe.tick);
+            ReplayFormat::PutVarint(index, keyframe.offset);
+        }
+        ReplayFormat::PutFixed(index, offset_, 8);
+        file_.write(index.data(), std::streamsize(index.size()));
+        file_.close();
+
+        return !file_.fail();
+    }
+
+private:
+    // recording is useless with event missing, so full queue makes thread wait for writer
+    // game window never gets there, queue takes many seconds of play
+    void Push(const ReplayEvent& event) noexcept
+    {
+        while (!queue_.Push(event))
+            std::this_thread::yield();
+    }
+
+    // writer thread, wakes up now and then, so thread which records never waits for it
+    void Write()
+    {
+        std::string buffer;
+        uint64_t tick = 0;
+
+        for (;;)
+        {
+            // events pushed before stop are seen once stop is seen
+            const bool stopping = stopping_.load(std::memory_order_acquire);
+
+            for (auto event = queue_.Front(); nullptr != event; event = queue_.Front())
+            {
+                if (eReplayCode::keyframe == event->code)
+                    index_.push_back({ event->tick, offset_ + buffer.size() });
+
+                if (eReplayCode::state == event->code || eReplayCode::keyframe == event->code)
+                {
+                    ReplayFormat::PutEvent(buffer, *event, tick, states_.Front());
+                    states_.Pop();
+                }
+                else
+                    ReplayFormat::PutEvent(buffer, *event, tick);
+                tick = event->tick;
+                queue_.Pop();
+            }
+
+            if (!buffer.empty())
+            {
+                file_.write(buffer.data(), std::streamsize(buffer.size()));
+                offset_ += buffer.size();
+                buffer.clear();
+            }
+
+            if (stopping)
+                break;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    }
+
+    // recording thread
+    bool recording_{};
+    uint64_t nextKeyframe_{};
+    std::vector<uint8_t> keyframeState_;
+
+    // writer thread while it runs
+    std::ofstream file_;
+    uint64_t offset_{};
+    std::vector<ReplayKeyframe> index_;
+
+    SpscQueue<ReplayEvent, 4096> queue_;
+    SpscQueue<std::vector<uint8_t>, 8> states_; // of state and keyframe events, vectors of slots are reused
+    std::atomic_bool stopping_{};
+    std::thread writer_;
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// plays recording without any waiting, checks state hashes of keyframes and end
+// play can start from any keyframe, game is set to state stored in it (recordings of version 1 and 2 are played from start)
+class ReplayPlayer
+{
+public:
+    struct Result
+    {
+        uint64_t startTick{};
+        uint64_t ticks{}; // tick game ended on
+        size_t events{};
+        size_t keyframes{}; // checked
+        size_t mismatches{}; // of keyframe hashes, states game did not take, and of score and lives at end
+        bool ended{}; // end event was reached and matched
+        uint64_t score{}; // of replayed game at end
+        uint64_t lives{};
+    };
+
+    // false when file is not recording of this version
+    bool Load(const char* path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        keyframes_.clear();
+
+        if (data_.size() < ReplayFormat::c_HeaderSize + 8 || 0 != data_.compare(0, 4, ReplayFormat::c_Magic, 4))
+            return false;
+
+        size_t pos = 4;
+        float width = 0.f;
+        float height = 0.f;
+        if (!ReplayFormat::GetFixed(data_, pos, 2, version_) || 0 == version_ || ReplayFormat::c_Version < version_
+            || !ReplayFormat::GetFixed(data_, pos, 8, seed_)
+            || !ReplayFormat::GetFloat(data_, pos, width)
+            || !ReplayFormat::GetFloat(data_, pos, height))
+        {
+            return false;
+        }
+        world_ = RectF(0.f, 0.f, width, height);
+
+        pos = data_.size() - 8;
+        uint64_t indexOffset = 0;
+        ReplayFormat::GetFixed(data_, pos, 8, indexOffset);
+        if (indexOffset < ReplayFormat::c_HeaderSize || indexOffset >= data_.size() - 8)
+            return false;
+
+        pos = size_t(indexOffset);
+        uint64_t count = 0;
+        if (!ReplayFormat::GetVarint(data_, pos, count))
+            return false;
+
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            ReplayKeyframe keyframe;
+            // keyframe event has to be within events, after header and before index
+            if (!ReplayFormat::GetVarint(data_, pos, keyframe.tick) || !ReplayFormat::GetVarint(data_, pos, keyframe.offset)
+                || keyframe.offset < ReplayFormat::c_HeaderSize || keyframe.offset >= indexOffset)
+            {
+                return false;
+            }
+            keyframes_.push_back(keyframe);
+        }
+
+        events_ = size_t(indexOffset);
+        return true;
+    }
+
+    uint64_t GetSeed() const noexcept { return seed_; }
+    const RectF& GetWorld() const noexcept { return world_; }
+    const std::vector<ReplayKeyframe>& GetKeyframes() const noexcept { return keyframes_; }
+
+    // plays to end, from start or from latest keyframe at or before fromTick
+    // ticks go by Step as in game, GameSimulation::Advance gets same game but not same bits of ball position
+    Result Play(uint64_t fromTick, GameSimulation* last = nullptr)
+    {
+        GameSettings settings;
+        settings.seed = seed_;
+        GameSimulation game(settings);
+        game.Resize(world_);
+        game.NewGame();
+
+        size_t pos = ReplayFormat::c_HeaderSize;
+        size_t keyframe = 0;
+        bool fromKeyframe = false;
+
+        for (size_t i = keyframes_.size(); i-- > 0 && version_ >= 3; )
+        {
+            if (keyframes_[i].tick <= fromTick && StartFrom(keyframes_[i], game))
+            {
+                pos = size_t(keyframes_[i].offset);
+                keyframe = i;
+                fromKeyframe = true;
+                break;
+            }
+        }
+
+        Result res;
+        res.startTick = game.GetTick();
+
+        uint64_t tick = game.GetTick();
+        ReplayEvent event;
+        while (pos < events_ && ReplayFormat::GetEvent(data_, pos, tick, event, version_))
+        {
+            // delta of first event read from keyframe is from event before it
+            if (fromKeyframe)
+            {
+                event.tick = keyframes_[keyframe].tick;
+                fromKeyframe = false;
+            }
+            tick = event.tick;
+            ++res.events;
+
+            while (game.GetTick() < event.tick)
+                game.Step(GameInputs());
+
+            GameInputs inputs;
+            switch (event.code)
+            {
+            case eReplayCode::left:
+                inputs.playerMoves = -1;
+                break;
+            case eReplayCode::right:
+                inputs.playerMoves = 1;
+                break;
+            case eReplayCode::pause:
+                inputs.togglePause = true;
+                break;
+            case eReplayCode::newGame:
+                inputs.newGame = true;
+                break;
+            case eReplayCode::resize:
+                game.Resize(RectF(0.f, 0.f, event.width, event.height));
+                break;
+            case eReplayCode::keyframe:
+                if (version_ >= ReplayFormat::c_FixedHashVersion)
+                {
+                    ++res.keyframes;
+                    res.mismatches += game.GetStateHash() == event.hash ? 0 : 1;
+                }
+                break;
+            case eReplayCode::state:
+                if (!game.LoadState(reinterpret_cast<const uint8_t*>(data_.data()) + event.stateOffset, event.stateSize))
+                    ++res.mismatches;
+                break;
+            case eReplayCode::end:
+                res.score = game.GetGameInformation()->GetScore();
+                res.lives = game.GetGameInformation()->GetLives();
+                res.ended = (version_ < ReplayFormat::c_FixedHashVersion || game.GetStateHash() == event.hash)
+                    && res.score == event.score && res.lives == event.lives;
+                res.mismatches += (res.score == event.score && res.lives == event.lives) ? 0 : 1;
+                break;
+            }
+
+            game.ApplyInputs(inputs);
+
+            if (eReplayCode::end == event.code)
+                break;
+        }
+
+        res.ticks = game.GetTick();
+        if (nullptr != last)
+            *last = game;
+        return res;
+    }
+
+private:
+    // game is set to tick, world and state of keyframe, false and game unchanged when event there is not keyframe with valid state
+    bool StartFrom(const ReplayKeyframe& keyframe, GameSimulation& game) const
+    {
+        auto pos = size_t(keyframe.offset);
+        ReplayEvent event;
+        if (!ReplayFormat::GetEvent(data_, pos, 0, event, version_) || eReplayCode::keyframe != event.code
+            || !std::isfinite(event.width) || !(event.width > 0.f) || !std::isfinite(event.height) || !(event.height > 0.f)
+            || !game.LoadState(reinterpret_cast<const uint8_t*>(data_.data()) + event.stateOffset, event.stateSize))
+        {
+            return false;
+        }
+
+        game.SetTick(keyframe.tick);
+        game.Resize(RectF(0.f, 0.f, event.width, event.height));
+        return true;
+    }
+
+    std::string data_;
+    size_t events_{}; // end of events
+    uint64_t version_{};
+    uint64_t seed_{};
+    RectF world_;
+    std::vector<ReplayKeyframe> keyframes_;
+};
@@ -0,0 +1,222 @@
+#pragma once
+
+// last seconds of game kept as state snapshots taken every few ticks, game goes back to them without creating its elements again
+// snapshots are in groups: first of group is whole state (keyframe), others are its difference to keyframe
+// difference is xor of state bytes with keyframe bytes, runs of zero bytes (fields not changed) are stored as their length only:
+//   length of zero run (varint), count of bytes which follow (varint), those bytes
+// group is dropped whole once ring overwrites its keyframe, so ring holds at least capacity - group size snapshots
+
+#include "simulation.h"
+
+class RewindBuffer
+{
+public:
+    static constexpr size_t c_GroupSize = 20;
+
+    // seconds kept at least, snapshot every interval ticks
+    RewindBuffer(float seconds, float ticksPerSecond, uint64_t interval)
+        : interval_(std::max<uint64_t>(interval, 1))
+    {
+        const auto snapshots = size_t(std::ceil(seconds * ticksPerSecond / float(interval_)));
+        slots_.resize((snapshots / c_GroupSize + 2) * c_GroupSize);
+    }
+
+    void Clear() noexcept
+    {
+        first_ = 0;
+        next_ = 0;
+        shift_ = 0;
+    }
+
+    // inputs game takes, called before they are applied: new game drops snapshots of game before it,
+    // so rewind does not go back into game which is over
+    void Input(const GameInputs& inputs) noexcept
+    {
+        if (inputs.newGame)
+            Clear();
+    }
+
+    // takes snapshot after game ticks, when interval passed since last one, true when it was taken
+    bool Update(const GameSimulation& game)
+    {
+        const auto now = GetTime(game);
+        if (next_ != first_ && now < GetSlot(next_ - 1).time + interval_)
+            return false;
+
+        // keyframe overwrites keyframe of oldest group, deltas of that group are useless without it
+        const auto index = next_++;
+        if (0 == index % c_GroupSize && index >= slots_.size())
+            first_ = std::max(first_, index - slots_.size() + c_GroupSize);
+
+        auto& slot = GetSlot(index);
+        slot.time = now;
+
+        if (0 == index % c_GroupSize)
+        {
+            game.SaveState(slot.data);
+            return true;
+        }
+
+        // state of same settings has always same size
+        game.SaveState(state_);
+        Encode(state_, GetSlot(index - index % c_GroupSize).data, slot.data);
+        return true;
+    }
+
+    // game goes back by ticks, to newest snapshot taken that many ticks ago or before it (oldest one if none is that old)
+    // snapshots after it are dropped, game time goes on from it, false when there is none or game does not take it
+    bool Rewind(uint64_t ticks, GameSimulation& game)
+    {
+        if (next_ == first_)
+            return false;
+
+        const auto now = GetTime(game);
+        const auto time = now > ticks ? now - ticks : 0;
+
+        auto index = next_ - 1;
+        while (index > first_ && GetSlot(index).time > time)
+            --index;
+
+        if (!Restore(index, state_) || !game.LoadState(state_.data(), state_.size()))
+            return false;
+
+        next_ = index + 1;
+        shift_ = int64_t(GetSlot(index).time) - int64_t(game.GetTick());
+        return true;
+    }
+
+    // state of snapshot taken that many snapshots before newest, false when there is no such
+    bool GetState(size_t back, std::vector<uint8_t>& state) const
+    {
+        if (back >= GetCount())
+            return false;
+
+        return Restore(next_ - 1 - back, state);
+    }
+
+    size_t GetCount() const noexcept { return size_t(next_ - first_); }
+    size_t GetCapacity() const noexcept { return slots_.size(); }
+
+    // ticks of game kept
+    uint64_t GetSpan() const noexcept
+    {
+        return next_ == first_ ? 0 : GetSlot(next_ - 1).time - GetSlot(first_).time;
+    }
+
+    // bytes of snapshots kept and all memory held by buffer
+    size_t GetStateBytes() const noexcept
+    {
+        size_t res = 0;
+        for (auto index = first_; index < next_; ++index)
+            res += GetSlot(index).data.size();
+        return res;
+    }
+
+    size_t GetMemory() const noexcept
+    {
+        size_t res = sizeof(*this) + slots_.capacity() * sizeof(Slot) + state_.capacity();
+        for (const auto& slot : slots_)
+            res += slot.data.capacity();
+        return res;
+    }
+
+private:
+    struct Slot
+    {
+        uint64_t time{}; // game time snapshot was taken on
+        std::vector<uint8_t> data; // state or difference to keyframe of group
+    };
+
+    // game ticks do not go back with game, so buffer has own time, it is tick of game moved by rewinds done
+    uint64_t GetTime(const GameSimulation& game) const noexcept
+    {
+        return uint64_t(int64_t(game.GetTick()) + shift_);
+    }
+
+    Slot& GetSlot(uint64_t index) noexcept { return slots_[size_t(index % slots_.size())]; }
+    const Slot& GetSlot(uint64_t index) const noexcept { return slots_[size_t(index % slots_.size())]; }
+
+    bool Restore(uint64_t index, std::vector<uint8_t>& state) const
+    {
+        const auto& keyframe = GetSlot(index - index % c_GroupSize).data;
+        state = keyframe;
+        return 0 == index % c_GroupSize || Decode(GetSlot(index).data, state);
+    }
+
+    static void PutVarint(std::vector<uint8_t>& out, size_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(uint8_t((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(uint8_t(value));
+    }
+
+    static bool GetVarint(const std::vector<uint8_t>& in, size_t& pos, size_t& value) noexcept
+    {
+        value = 0;
+        for (unsigned shift = 0; pos < in.size() && shift < 64; shift += 7)
+        {
+            const auto byte = in[pos++];
+            value |= size_t(byte & 0x7f) << shift;
+            if (0 == (byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    // state and keyframe are of same size, empty delta is state same as keyframe
+    static void Encode(const std::vector<uint8_t>& state, const std::vector<uint8_t>& keyframe, std::vector<uint8_t>& delta)
+    {
+        delta.clear();
+        size_t pos = 0;
+        while (pos < state.size())
+        {
+            const auto zeros = pos;
+            while (pos < state.size() && state[pos] == keyframe[pos])
+                ++pos;
+            if (pos == state.size())
+                break;
+
+            const auto literals = pos;
+            while (pos < state.size() && state[pos] != keyframe[pos])
+                ++pos;
+
+            PutVarint(delta, literals - zeros);
+            PutVarint(delta, pos - literals);
+            for (auto i = literals; i < pos; ++i)
+                delta.push_back(uint8_t(state[i] ^ keyframe[i]));
+        }
+    }
+
+    // state holds keyframe, difference is applied to it in place
+    static bool Decode(const std::vector<uint8_t>& delta, std::vector<uint8_t>& state) noexcept
+    {
+        if (state.empty())
+            return false;
+
+        size_t pos = 0;
+        size_t out = 0;
+        while (pos < delta.size())
+        {
+            size_t zeros = 0;
+            size_t literals = 0;
+            if (!GetVarint(delta, pos, zeros) || !GetVarint(delta, pos, literals)
+                || state.size() - out < zeros || state.size() - out - zeros < literals || delta.size() - pos < literals)
+                return false;
+
+            out += zeros;
+            for (size_t i = 0; i < literals; ++i)
+                state[out++] ^= delta[pos++];
+        }
+        return true;
+    }
+
+    std::vector<Slot> slots_;
+    uint64_t first_{}; // index of oldest snapshot kept, always keyframe or delta of kept keyframe
+    uint64_t next_{}; // index of next snapshot
+    uint64_t interval_{};
+    int64_t shift_{};
+    std::vector<uint8_t> state_; // reused for saving and restoring
+};
@@ -0,0 +1,123 @@
+#pragma once
+
+// whole game saved as fixed layout header and state bytes of GameSimulation::SaveState, nothing is parsed on load:
+// header is checked and state is copied into elements of existing simulation, so save can be read from mapped file as it is
+// state is made of fixed width values (src/state.h), so 32 and 64 bit builds write and read same layout
+// loaded values are checked: world size finite and positive, lives and score not above those of game, bools and enums in range,
+// floats finite, ball direction unit vector, count of targets that of alive set
+
+#include "simulation.h"
+
+#include <fstream>
+
+struct SaveGameHeader
+{
+    static constexpr char c_Magic[4] = { 'B', 'R', 'K', 'S' };
+    static constexpr uint16_t c_Version = 2; // 2 - fixed width state with ball color
+
+    char magic[4]{};
+    uint16_t version{};
+    uint16_t headerSize{}; // header of newer version may be longer, state starts after it
+    uint32_t stateSize{};
+    uint32_t targets{}; // slots of targets, settings of game have to give same count
+    uint64_t tick{};
+    float worldWidth{};
+    float worldHeight{};
+    uint64_t checksum{}; // of state bytes, GetChecksum
+};
+
+static_assert(sizeof(SaveGameHeader) == 40, "header layout is fixed");
+static_assert(std::is_trivially_copyable<SaveGameHeader>::value, "header is copied as bytes");
+
+// fixed parts of state of version 2, change of any of them needs new version
+static_assert(GameSimulation::c_StateSize == 28 && GameInformation::c_StateSize == 27 && Player::c_StateSize == 8
+    && Ball::c_StateSize == 32 && Targets::c_StateSize == 4, "state layout of save version 2");
+
+namespace SaveGame
+{
+    // FNV-1a over 8 byte words and bytes after last whole word, one multiply per word instead of per byte
+    inline uint64_t GetChecksum(const uint8_t* data, size_t size) noexcept
+    {
+        uint64_t hash = 14695981039346656037ull;
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            uint64_t word = 0;
+            std::memcpy(&word, data + i, sizeof(word));
+            hash = (hash ^ word) * 1099511628211ull;
+        }
+        for (; i < size; ++i)
+            hash = (hash ^ data[i]) * 1099511628211ull;
+        return hash;
+    }
+
+    // out keeps its capacity, so saves of same game do not allocate after first one
+    inline void Save(const GameSimulation& game, std::vector<uint8_t>& out)
+    {
+        // state is written after room left for header, header is filled once state size is known
+        game.SaveState(out, sizeof(SaveGameHeader));
+
+        SaveGameHeader header;
+        std::memcpy(header.magic, SaveGameHeader::c_Magic, sizeof(header.magic));
+        header.version = SaveGameHeader::c_Version;
+        header.headerSize = uint16_t(sizeof(SaveGameHeader));
+        header.stateSize = uint32_t(out.size() - sizeof(SaveGameHeader));
+        header.targets = uint32_t(game.GetTargets()->GetCount());
+        header.tick = game.GetTick();
+        header.worldWidth = game.GetWorld().Width;
+        header.worldHeight = game.GetWorld().Height;
+        header.checksum = GetChecksum(out.data() + sizeof(SaveGameHeader), header.stateSize);
+        std::memcpy(out.data(), &header, sizeof(header));
+    }
+
+    // game takes saved tick and world, false when data is not whole save of this version or does not fit settings of game
+    // whole save is checked before game is changed, so game is left as it was when it is refused
+    inline bool Load(GameSimulation& game, const uint8_t* data, size_t size)
+    {
+        SaveGameHeader header;
+        if (size < sizeof(header))
+            return false;
+
+        std::memcpy(&header, data, sizeof(header));
+        if (0 != std::memcmp(header.magic, SaveGameHeader::c_Magic, sizeof(header.magic))
+            || SaveGameHeader::c_Version != header.version
+            || sizeof(SaveGameHeader) != header.headerSize
+            || size - sizeof(header) != header.stateSize
+            || game.GetStateSize() != header.stateSize
+            || game.GetTargets()->GetCount() != header.targets
+            || !std::isfinite(header.worldWidth) || !(header.worldWidth > 0.f)
+            || !std::isfinite(header.worldHeight) || !(header.worldHeight > 0.f)
+            || GetChecksum(data + sizeof(header), header.stateSize) != header.checksum)
+        {
+            return false;
+        }
+
+        // state does not depend on world, so layout is done after it is taken
+        if (!game.LoadState(data + sizeof(header), header.stateSize))
+            return false;
+
+        const RectF world(0.f, 0.f, header.worldWidth, header.worldHeight);
+        if (!world.Equals(game.GetWorld()))
+            game.Resize(world);
+
+        game.SetTick(header.tick);
+        return true;
+    }
+
+    inline bool Write(const char* path, const std::vector<uint8_t>& save)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(save.data()), std::streamsize(save.size()));
+        return !file.fail();
+    }
+
+    inline bool Read(const char* path, std::vector<uint8_t>& save)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        save.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+}
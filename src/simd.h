@@ -0,0 +1,67 @@
+#pragma once
+
+// instruction set detection for kernels chosen at run time
+// kernels for wider instruction sets are compiled with target attributes (GCC, Clang) or as is (MSVC),
+// so whole program still runs on any x86 CPU
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BREAKOUT_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(BREAKOUT_X86) && !defined(_MSC_VER)
+#define BREAKOUT_TARGET_SSE2 __attribute__((target("sse2")))
+#define BREAKOUT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define BREAKOUT_TARGET_SSE2
+#define BREAKOUT_TARGET_AVX2
+#endif
+
+#ifdef BREAKOUT_X86
+
+inline bool IsAvx2Supported() noexcept
+{
+#ifdef _MSC_VER
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    __cpuid(info, 1);
+    const bool osxsave = 0 != (info[2] & (1 << 27));
+    const bool avx = 0 != (info[2] & (1 << 28));
+    if (!osxsave || !avx)
+        return false;
+
+    // OS saves ymm registers
+    if ((_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return 0 != (info[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // BREAKOUT_X86
+
+enum class eSimdLevel
+{
+    scalar,
+    sse2,
+    avx2,
+};
+
+inline eSimdLevel GetSupportedSimdLevel() noexcept
+{
+#ifdef BREAKOUT_X86
+    static const auto level = IsAvx2Supported() ? eSimdLevel::avx2 : eSimdLevel::sse2;
+    return level;
+#else
+    return eSimdLevel::scalar;
+#endif
+}
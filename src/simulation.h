@@ -0,0 +1,650 @@
+#pragma once
+
+#include "elements.h"
+
+// test mode - ball moves with max speed and ricochet from playground bottom
+// useful to verify that game can be won
+constexpr bool c_TestMode = false;
+
+struct GameSettings
+{
+    float worldWidth = 484.f; // pixels, client area of default game window
+    float worldHeight = 561.f; // pixels
+
+    uint64_t seed = 1; // of first game, next games take seeds from generator seeded with it
+
+    float ticksPerSecond = 100.f; // simulation steps per second of game time
+    float framesPerSecond = 60.f; // render rate of game window
+    size_t maxTicksPerUpdate = 5; // catch-up limit, game slows down when machine falls behind more
+
+    float rewindSeconds = 30.f; // game time game window can go back by
+    size_t rewindInterval = 5; // ticks between rewind snapshots
+
+    size_t livesStart = 3;
+    float gameInformationHeight = 60.f; // pixels
+    std::set <size_t> hitsForSpeedUp{ 4, 12 };
+    std::set <size_t> linesForSpeedUp{ 4, 6 };
+
+    float playerHeight = 10.f; // pixels
+    size_t playerStartPosition = 5;
+    size_t playerPositionsCount = 10;
+    size_t playerSplitOnHitTop = 2;
+
+    float ballRadius = 7.f; // pixels
+    float ballSpeedUpKoeff = 1.2f;
+    float ballSpeedBase = c_TestMode ? 50.f : 0.5f; // relative to rect per second
+    PointF ballStartDirection{ 0.5f, 1.0f }; // x and y of vector (negative is up/left)
+    PointF ballStartPosition{ 0.5f, 0.5f }; // relative to rect, center
+
+    Targets::TLines targetLines = {
+        {0,{Color::Yellow,1}},
+        {1,{Color::Yellow,1}},
+        {2,{Color::Green,3}},
+        {3,{Color::Green,3}},
+        {4,{Color::Orange,5}},
+        {5,{Color::Orange,5}},
+        {6,{Color::Red,7}},
+        {7,{Color::Red,7}}
+    };
+
+    size_t targetsInLine = 13;
+    float targetsMargin = 5.f; // pixels
+    float targetsTopMargin = 30.f; // pixels
+    float targetHeight = 10.f; // pixels
+};
+
+// ball may bounce several times within one tick, limit protects from endless loop in corners
+// ball moves by rest of tick without contacts once limit is reached, walls behind it are hit at once on next tick
+constexpr size_t c_MaxContactsPerTick = 16;
+
+// ball stops this far from contact point, so next static hit test does not see it again
+constexpr float c_ContactGap = 0.01f; // world units
+
+// user commands collected between two simulation steps
+struct GameInputs
+{
+    int  playerMoves = 0; // negative is left, positive is right
+    bool togglePause = false;
+    bool newGame = false;
+    bool rewind = false; // goes to rewind buffer of caller, simulation does not apply it
+};
+
+// game rules and state, no window or drawing dependencies
+// geometry is kept in world units, world rect is set by Resize (pixels of client area for game window)
+class GameSimulation
+{
+public:
+    explicit GameSimulation(const GameSettings& settings = GameSettings())
+        : settings_(settings)
+        , world_(0.f, 0.f, settings.worldWidth, settings.worldHeight)
+        , seeds_(settings.seed)
+        , seed_(settings.seed)
+        , nextSeed_(settings.seed)
+    {
+        CreateGameElements();
+    }
+
+    // deep copy, game goes on from copy same as from original
+    GameSimulation(const GameSimulation& other)
+    {
+        *this = other;
+    }
+
+    GameSimulation& operator=(const GameSimulation& other)
+    {
+        if (this == &other)
+            return *this;
+
+        settings_ = other.settings_;
+        world_ = other.world_;
+        seeds_ = other.seeds_;
+        seed_ = other.seed_;
+        nextSeed_ = other.nextSeed_;
+        playground_ = std::make_unique<Playgroud>(*other.playground_);
+        gameInfo_ = std::make_unique<GameInformation>(*other.gameInfo_);
+        player_ = std::make_unique<Player>(*other.player_);
+        ball_ = std::make_unique<Ball>(*other.ball_);
+        targets_ = std::make_unique<Targets>(*other.targets_);
+        tick_ = other.tick_;
+        ballFrom_ = other.ballFrom_;
+        return *this;
+    }
+
+    void NewGame()
+    {
+        const auto seed = nextSeed_;
+        nextSeed_ = seeds_.Next64();
+        NewGame(seed);
+    }
+
+    // game plays same from same seed with same inputs on same ticks
+    void NewGame(uint64_t seed)
+    {
+        seed_ = seed;
+        CreateGameElements();
+        gameInfo_->SetPaused(false);
+    }
+
+    // seed of current game
+    uint64_t GetSeed() const noexcept { return seed_; }
+
+    void Resize(const RectF& world)
+    {
+        world_ = world;
+        LayoutGameElements();
+    }
+
+    // returns true when inputs changed game state
+    bool ApplyInputs(const GameInputs& inputs)
+    {
+        bool changed = false;
+
+        if (inputs.newGame)
+        {
+            NewGame();
+            changed = true;
+        }
+
+        if (inputs.togglePause && !gameInfo_->IsOver())
+        {
+            gameInfo_->SetPaused(!gameInfo_->IsPaused());
+            changed = true;
+        }
+
+        if (0 != inputs.playerMoves && !gameInfo_->IsPaused())
+        {
+            for (int i = 0; i < inputs.playerMoves; ++i)
+                player_->MoveRight();
+            for (int i = 0; i > inputs.playerMoves; --i)
+                player_->MoveLeft();
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    void Step(const GameInputs& inputs)
+    {
+        ballFrom_ = *ball_->GetBounds();
+        ApplyInputs(inputs);
+        ProcessGameLogic();
+        ++tick_;
+    }
+
+    // runs up to ticks without inputs, ticks of free flight are done by one move straight to the tick of next contact
+    // game goes as by calling Step with empty inputs that many times, but not bit for bit: one long move rounds
+    // ball position differently than many short ones, so contact may come a tick later or sooner
+    // stops after tick with contact or end of game, so caller can apply inputs timed to it, returns ticks done
+    size_t Advance(size_t ticks)
+    {
+        size_t done = 0;
+        while (done < ticks)
+        {
+            // nothing moves while paused or over
+            if (gameInfo_->IsOver() || gameInfo_->IsPaused())
+            {
+                tick_ += ticks - done;
+                return ticks;
+            }
+
+            ballFrom_ = *ball_->GetBounds();
+            const bool contact = ProcessGameLogic();
+            ++tick_;
+            ++done;
+
+            if (contact)
+                break;
+
+            const auto free = GetFreeTicks(ticks - done);
+            if (free > 0)
+            {
+                ball_->Move(float(free - 1));
+                ballFrom_ = *ball_->GetBounds();
+                ball_->Move(1.f);
+                tick_ += free;
+                done += free;
+            }
+        }
+
+        return done;
+    }
+
+    // ticks done by Step and Advance since simulation was created
+    uint64_t GetTick() const noexcept { return tick_; }
+
+    // tick of loaded game, state of game does not hold it
+    void SetTick(uint64_t tick) noexcept { tick_ = tick; }
+
+    // paused or over, ticks change nothing until inputs come
+    bool IsIdle() const noexcept
+    {
+        return gameInfo_->IsPaused() || gameInfo_->IsOver();
+    }
+
+    // hash of what decides how game goes on: tick, ball, player, alive targets, score, lives and game state
+    // same inputs on same ticks give same hashes, replay checks it, values are hashed as fixed width values of state
+    uint64_t GetStateHash() const
+    {
+        FrameSnapshot frame;
+        Capture(frame);
+
+        StateHash hash;
+        hash.Add(seed_);
+        hash.Add(tick_);
+        hash.Add(ball_->GetMovement());
+        hash.Add(frame.ball.rect);
+        hash.Add(frame.player.rect);
+        hash.Add(uint64_t(frame.targets.size()));
+        for (const auto& target : frame.targets)
+            hash.Add(target.rect);
+        hash.Add(uint64_t(frame.info.score));
+        hash.Add(uint64_t(frame.info.lives));
+        hash.Add(uint8_t(frame.info.paused));
+        hash.Add(uint8_t(frame.info.victory));
+        hash.Add(uint8_t(frame.info.fail));
+        return hash.Get();
+    }
+
+    // count of targets, generator of seeds, seed, next seed, then states of elements
+    static constexpr size_t c_StateSize = 4 + 8 + 8 + 8;
+
+    // bytes of SaveState, same for all games of same settings
+    size_t GetStateSize() const noexcept
+    {
+        return c_StateSize + gameInfo_->GetStateSize() + Player::c_StateSize + Ball::c_StateSize + targets_->GetStateSize();
+    }
+
+    // state of game in play without layout, out keeps its capacity, so next state of same game does not allocate
+    // world and tick are not part of it, state goes into simulation of any world size and ticks keep going on after load
+    // state is written after offset bytes of out, they are kept (e.g. room for header)
+    void SaveState(std::vector<uint8_t>& out, size_t offset = 0) const
+    {
+        StateWriter writer(out, offset);
+        writer.Add(uint32_t(targets_->GetCount()));
+        writer.Add(seeds_.GetState());
+        writer.Add(seed_);
+        writer.Add(nextSeed_);
+        gameInfo_->SaveState(writer);
+        player_->SaveState(writer);
+        ball_->SaveState(writer);
+        targets_->SaveState(writer);
+    }
+
+    // restores state of SaveState by same settings without creating elements again, bounds are updated for current world
+    // whole state is checked before anything is taken from it, false and game left as it was when it does not fit these settings
+    bool LoadState(const uint8_t* data, size_t size)
+    {
+        if (size != GetStateSize() || !ReadState(data, size, false))
+            return false;
+
+        ReadState(data, size, true);
+        ballFrom_ = *ball_->GetBounds();
+        return true;
+    }
+
+    // copies everything renderer needs, targets vector of frame is reused
+    void Capture(FrameSnapshot& frame) const
+    {
+        frame.tick = tick_;
+        playground_->Capture(frame.playground);
+        gameInfo_->Capture(frame.info);
+        player_->Capture(frame.player);
+        ball_->Capture(frame.ball);
+        frame.ballFrom = ballFrom_;
+        targets_->Capture(frame.targets);
+        frame.targetsVersion = targets_->GetVersion();
+    }
+
+    const GameSettings& GetSettings() const noexcept { return settings_; }
+    const RectF& GetWorld() const noexcept { return world_; }
+
+    const Playgroud* GetPlayground() const noexcept { return playground_.get(); }
+    const GameInformation* GetGameInformation() const noexcept { return gameInfo_.get(); }
+    const Player* GetPlayer() const noexcept { return player_.get(); }
+    const Ball* GetBall() const noexcept { return ball_.get(); }
+    const Targets* GetTargets() const noexcept { return targets_.get(); }
+
+private:
+
+    void CreateGameElements()
+    {
+        playground_ = std::make_unique< Playgroud>(
+            Color::Black,
+            settings_.gameInformationHeight);
+
+        size_t scoreMax = 0;
+        for (const auto& line : settings_.targetLines)
+            scoreMax += line.second.second * settings_.targetsInLine;
+
+        gameInfo_ = std::make_unique< GameInformation>(
+            Color::DarkBlue,
+            settings_.gameInformationHeight,
+            settings_.livesStart,
+            settings_.targetLines.size(),
+            scoreMax);
+
+        player_ = std::make_unique<Player>(
+            Color::White,
+            settings_.playerHeight,
+            settings_.playerStartPosition,
+            settings_.playerPositionsCount);
+
+        ball_ = std::make_unique<Ball>(
+            Color::White,
+            settings_.ballRadius,
+            settings_.ballSpeedBase / settings_.ticksPerSecond,
+            settings_.ballStartDirection,
+            settings_.ballStartPosition,
+            seed_);
+
+        targets_ = std::make_unique<Targets>(
+            settings_.targetLines,
+            settings_.targetsInLine,
+            settings_.targetsMargin,
+            settings_.targetsTopMargin,
+            settings_.targetHeight);
+
+        LayoutGameElements();
+    }
+
+    // with apply false state is only read and checked
+    bool ReadState(const uint8_t* data, size_t size, bool apply)
+    {
+        StateReader reader(data, size);
+
+        uint32_t targets = 0;
+        uint64_t seeds = 0;
+        uint64_t seed = 0;
+        uint64_t nextSeed = 0;
+        if (!reader.Get(targets) || targets != targets_->GetCount() || !reader.Get(seeds) || !reader.Get(seed) || !reader.Get(nextSeed)
+            || !gameInfo_->LoadState(reader, apply) || !player_->LoadState(reader, apply) || !ball_->LoadState(reader, apply)
+            || !targets_->LoadState(reader, apply) || !reader.IsAtEnd())
+            return false;
+
+        if (apply)
+        {
+            seeds_.SetState(seeds);
+            seed_ = seed;
+            nextSeed_ = nextSeed;
+        }
+        return true;
+    }
+
+    void LayoutGameElements()
+    {
+        playground_->Layout(&world_);
+        gameInfo_->Layout(&world_);
+
+        auto playgroundRect = playground_->GetBounds();
+
+        player_->Layout(playgroundRect);
+        ball_->Layout(playgroundRect);
+        targets_->Layout(playgroundRect);
+
+        ballFrom_ = *ball_->GetBounds();
+    }
+
+    // returns true when ball hit something or game ended during tick
+    bool ProcessGameLogic()
+    {
+        ProfileScope profile(eProfilePhase::gameLogic);
+
+        if (gameInfo_->IsOver())
+            return false;
+
+        if (gameInfo_->IsPaused())
+            return false;
+
+        if (targets_->IsEmpty())
+        {
+            gameInfo_->SetPaused(true);
+            gameInfo_->SetVictory();
+            return true;
+        }
+
+        bool contact = ProcessBallHits();
+
+        if (!gameInfo_->IsOver())
+            contact = MoveBall() || contact;
+
+        return contact;
+    }
+
+    enum class eContact
+    {
+        none,
+        wall,
+        player,
+        target,
+    };
+
+    // earliest contact of ball moving by movement within [0, maxTime] (in ticks)
+    eContact FindContact(const PointF& movement, float maxTime, float& time, eHitFace& face, size_t& target) const
+    {
+        const auto ball = ball_->GetBounds();
+
+        auto contact = eContact::none;
+        time = maxTime;
+        face = eHitFace::none;
+        target = Targets::c_NoTarget;
+
+        float t = 0.f;
+        eHitFace f = eHitFace::none;
+
+        if (SweepOutside(*ball, movement, *player_->GetBounds(), time, t, f))
+        {
+            contact = eContact::player;
+            time = t;
+            face = f;
+        }
+
+        if (SweepInside(*ball, movement, *playground_->GetBounds(), time, t, f)
+            && (eContact::none == contact || t < time))
+        {
+            contact = eContact::wall;
+            time = t;
+            face = f;
+        }
+
+        const auto hit = targets_->GetFirstContact(ball_.get(), movement, time, t, f);
+        if (Targets::c_NoTarget != hit && (eContact::none == contact || t < time))
+        {
+            contact = eContact::target;
+            time = t;
+            face = f;
+            target = hit;
+        }
+
+        return contact;
+    }
+
+    // whole ticks ball flies before tick of next contact, up to maxTicks
+    size_t GetFreeTicks(size_t maxTicks) const
+    {
+        if (0 == maxTicks)
+            return 0;
+
+        float time = 0.f;
+        eHitFace face = eHitFace::none;
+        size_t target = Targets::c_NoTarget;
+        if (eContact::none == FindContact(ball_->GetMovement(), float(maxTicks), time, face, target))
+            return maxTicks;
+
+        // contact at end of tick belongs to that tick, as in MoveBall
+        return size_t(std::max(std::ceil(time) - 1.f, 0.f));
+    }
+
+    // moves ball along its path for one tick, finds exact time of each contact on the way and bounces
+    // returns true when there was a contact
+    bool MoveBall()
+    {
+        float remaining = 1.f;
+        bool res = false;
+
+        for (size_t i = 0; i < c_MaxContactsPerTick && remaining > 0.f; ++i)
+        {
+            const auto movement = ball_->GetMovement();
+            const auto length = std::hypot(movement.X, movement.Y);
+            if (!(length > 0.f))
+                return res;
+
+            float time = 0.f;
+            eHitFace face = eHitFace::none;
+            size_t target = Targets::c_NoTarget;
+
+            const auto contact = FindContact(movement, remaining, time, face, target);
+            if (eContact::none == contact)
+            {
+                ball_->Move(remaining);
+                return res;
+            }
+
+            ball_->Move(std::max(time - c_ContactGap / length, 0.f));
+            remaining -= time;
+            res = true;
+
+            ProcessContact(contact, face, target);
+
+            if (gameInfo_->IsOver())
+                return res;
+        }
+
+        // limit reached, ball does not lose distance of tick
+        if (remaining > 0.f)
+            ball_->Move(remaining);
+
+        return res;
+    }
+
+    void ProcessContact(eContact contact, eHitFace face, size_t target)
+    {
+        ball_->HitWithFace(face);
+
+        switch (contact)
+        {
+        case eContact::wall:
+            if (eHitFace::bottom == face)
+                ProcessHitBottom();
+            else if (eHitFace::top == face)
+                ProcessHitTop();
+            break;
+
+        case eContact::target:
+            ProcessHitTarget(target);
+            targets_->RemoveTarget(target);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    // static hit tests at ball position, returns true when ball hit something
+    bool ProcessBallHits()
+    {
+        ProfileScope profile(eProfilePhase::ballHits);
+
+        if (ball_->HitWithTop(player_.get(), Ball::eHitType::hitOutside)
+            || ball_->HitWithBottom(player_.get(), Ball::eHitType::hitOutside))
+        {
+            return true;
+        }
+
+        bool res = false;
+
+        if (ball_->HitWithBottom(playground_.get(), Ball::eHitType::hitInside))
+        {
+            if (c_TestMode)
+                return true;
+
+            ProcessHitBottom();
+            res = true;
+        }
+
+        if (ball_->HitWithTop(playground_.get(), Ball::eHitType::hitInside))
+        {
+            ProcessHitTop();
+            res = true;
+        }
+
+        {
+            const auto target = targets_->GetTargetHitWithBall(ball_.get());
+            if (Targets::c_NoTarget != target)
+            {
+                ProcessHitTarget(target);
+                targets_->RemoveTarget(target);
+
+                return true;
+            }
+        }
+
+        if (ball_->HitWithLeft(playground_.get(), Ball::eHitType::hitInside))
+            res = true;
+        if (ball_->HitWithRight(playground_.get(), Ball::eHitType::hitInside))
+            res = true;
+
+        return res;
+    }
+
+    void ProcessHitBottom()
+    {
+        if (c_TestMode)
+            return;
+
+        gameInfo_->RemoveLife();
+
+        if (gameInfo_->NoMoreLives())
+        {
+            ball_->SetColor(Color::Red);
+            gameInfo_->SetPaused(true);
+            gameInfo_->SetFail();
+        }
+    }
+
+    void ProcessHitTop()
+    {
+        if (!gameInfo_->IsHitTop())
+        {
+            gameInfo_->SetHitTop();
+            player_->SplitBy(settings_.playerSplitOnHitTop);
+        }
+    }
+
+    void ProcessHitTarget(size_t target)
+    {
+        gameInfo_->AddToScore(targets_->GetCost(target));
+
+        gameInfo_->IncrementHits();
+
+        const auto hits = gameInfo_->GetHits();
+
+        const auto line = targets_->GetLine(target);
+
+        const auto newHitLine = !gameInfo_->IsHitLine(line);
+        if (newHitLine)
+            gameInfo_->SetHitLine(line);
+
+        const bool speedUpBall = (settings_.hitsForSpeedUp.count(hits) > 0) || (newHitLine && settings_.linesForSpeedUp.count(line) > 0);
+
+        if (speedUpBall)
+        {
+            ball_->SpeedUp(settings_.ballSpeedUpKoeff);
+        }
+    }
+
+private:
+    GameSettings settings_;
+    RectF world_;
+    Random seeds_; // seeds of next games
+    uint64_t seed_{};
+    uint64_t nextSeed_{};
+
+    std::unique_ptr<Playgroud> playground_;
+    std::unique_ptr<GameInformation> gameInfo_;
+    std::unique_ptr<Player> player_;
+    std::unique_ptr<Ball> ball_;
+    std::unique_ptr<Targets> targets_;
+
+    uint64_t tick_{};
+    RectF ballFrom_; // ball bounds before last tick, for render interpolation
+};
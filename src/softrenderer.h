@@ -0,0 +1,292 @@
+#pragma once
+
+// software rasterizer, draws into 32 bit framebuffer in memory, framebuffer can be presented as GDI 32 bpp bitmap as is
+
+#include "renderer.h"
+#include "simd.h"
+#include "font.h"
+#include "framebuffer.h"
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// span fill kernels, opaque color into count pixels
+
+using TFillSpan = void(*)(uint32_t* dst, size_t count, uint32_t color);
+
+inline void FillSpanScalar(uint32_t* dst, size_t count, uint32_t color) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+        dst[i] = color;
+}
+
+#ifdef BREAKOUT_X86
+
+BREAKOUT_TARGET_SSE2 inline void FillSpanSse2(uint32_t* dst, size_t count, uint32_t color) noexcept
+{
+    const __m128i value = _mm_set1_epi32(int(color));
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), value);
+
+    FillSpanScalar(dst + i, count - i, color);
+}
+
+BREAKOUT_TARGET_AVX2 inline void FillSpanAvx2(uint32_t* dst, size_t count, uint32_t color) noexcept
+{
+    const __m256i value = _mm256_set1_epi32(int(color));
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), value);
+
+    FillSpanSse2(dst + i, count - i, color);
+}
+
+#endif // BREAKOUT_X86
+
+inline TFillSpan GetFillSpan(eSimdLevel level) noexcept
+{
+#ifdef BREAKOUT_X86
+    switch (level)
+    {
+    case eSimdLevel::avx2:
+        return FillSpanAvx2;
+    case eSimdLevel::sse2:
+        return FillSpanSse2;
+    default:
+        break;
+    }
+#else
+    (void)level;
+#endif
+    return FillSpanScalar;
+}
+
+// source over blend of color with coverage (0 - 255) into pixel
+inline uint32_t BlendPixel(uint32_t dst, uint32_t color, uint32_t coverage) noexcept
+{
+    const auto alpha = ((color >> 24) * coverage + 127) / 255;
+    if (0 == alpha)
+        return dst;
+    if (255 == alpha)
+        return color;
+
+    const auto blend = [alpha](uint32_t d, uint32_t s) { return (d * (255 - alpha) + s * alpha + 127) / 255; };
+
+    const auto a = alpha + ((dst >> 24) * (255 - alpha) + 127) / 255;
+    const auto r = blend((dst >> 16) & 0xFF, (color >> 16) & 0xFF);
+    const auto g = blend((dst >> 8) & 0xFF, (color >> 8) & 0xFF);
+    const auto b = blend(dst & 0xFF, color & 0xFF);
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// rects cover pixels with centers inside them (no antialiasing, same as GDI+ default),
+// ellipses get analytic coverage of their edge, glyphs are blended from font coverage
+class SoftwareRenderer
+    : public IRenderer
+{
+public:
+    SoftwareRenderer(Framebuffer& framebuffer, eSimdLevel level = GetSupportedSimdLevel())
+        : framebuffer_(framebuffer)
+        , fillSpan_(GetFillSpan(level))
+    {
+        SetClip(nullptr);
+    }
+
+    // pixels touched by rect
+    void SetClip(const RectF* rect) override final
+    {
+        clipLeft_ = 0;
+        clipTop_ = 0;
+        clipRight_ = framebuffer_.GetWidth();
+        clipBottom_ = framebuffer_.GetHeight();
+        if (nullptr == rect)
+            return;
+
+        clipLeft_ = std::clamp(int(std::floor(rect->GetLeft())), 0, clipRight_);
+        clipTop_ = std::clamp(int(std::floor(rect->GetTop())), 0, clipBottom_);
+        clipRight_ = std::clamp(int(std::ceil(rect->GetRight())), clipLeft_, clipRight_);
+        clipBottom_ = std::clamp(int(std::ceil(rect->GetBottom())), clipTop_, clipBottom_);
+    }
+
+    void FillRectangle(const RectF& rect, const Color& color) override final
+    {
+        const auto x0 = std::max(ToPixel(rect.GetLeft()), clipLeft_);
+        const auto x1 = std::min(ToPixel(rect.GetRight()), clipRight_);
+        const auto y0 = std::max(ToPixel(rect.GetTop()), clipTop_);
+        const auto y1 = std::min(ToPixel(rect.GetBottom()), clipBottom_);
+        if (x0 >= x1 || y0 >= y1)
+            return;
+
+        for (int y = y0; y < y1; ++y)
+            FillSpan(framebuffer_.GetRow(y), x0, x1, color.GetValue());
+    }
+
+    // fills are bound by memory bandwidth and span kernel is already chosen once, so batch is filled rect by rect
+    // (walking rows of whole batch was measured slower), batches pay off on GDI+ where each command costs a call and a brush
+    void FillRectangles(const RectF* rects, size_t count, const Color& color) override final
+    {
+        for (size_t i = 0; i < count; ++i)
+            FillRectangle(rects[i], color);
+    }
+
+    void FillEllipse(const RectF& rect, const Color& color) override final
+    {
+        if (!(rect.Width > 0.f) || !(rect.Height > 0.f))
+            return;
+
+        const auto value = color.GetValue();
+
+        // ellipse is scaled along y to circle of radius rx
+        const auto rx = rect.Width / 2.f;
+        const auto cx = rect.X + rx;
+        const auto cy = rect.Y + rect.Height / 2.f;
+        const auto scaleY = rect.Width / rect.Height;
+
+        const auto outer = rx + 0.5f;
+        const auto inner = rx - 0.5f;
+
+        const auto y0 = std::max(int(std::floor(rect.GetTop())), clipTop_);
+        const auto y1 = std::min(int(std::ceil(rect.GetBottom())), clipBottom_);
+
+        for (int y = y0; y < y1; ++y)
+        {
+            const auto dy = (y + 0.5f - cy) * scaleY;
+            if (std::fabs(dy) >= outer)
+                continue;
+
+            auto row = framebuffer_.GetRow(y);
+
+            // pixels with center nearer than inner radius are fully covered
+            int fullFirst = clipLeft_;
+            int fullLast = clipLeft_ - 1;
+            if (inner > 0.f && std::fabs(dy) <= inner)
+            {
+                const auto half = std::sqrt(inner * inner - dy * dy);
+                fullFirst = std::max(int(std::ceil(cx - half - 0.5f)), clipLeft_);
+                fullLast = std::min(int(std::floor(cx + half - 0.5f)), clipRight_ - 1);
+                FillSpan(row, fullFirst, fullLast + 1, value);
+            }
+
+            // edge pixels, coverage by distance of pixel center to circle
+            const auto half = std::sqrt(outer * outer - dy * dy);
+            const auto first = std::max(int(std::floor(cx - half)), clipLeft_);
+            const auto last = std::min(int(std::ceil(cx + half)), clipRight_ - 1);
+            for (int x = first; x <= last; ++x)
+            {
+                if (x >= fullFirst && x <= fullLast)
+                {
+                    x = fullLast;
+                    continue;
+                }
+
+                const auto distance = std::hypot(x + 0.5f - cx, dy);
+                const auto coverage = std::clamp(outer - distance, 0.f, 1.f);
+                if (coverage > 0.f)
+                    row[x] = BlendPixel(row[x], value, uint32_t(coverage * 255.f + 0.5f));
+            }
+        }
+    }
+
+    // pixels inside clip from source of same size, e.g. prerendered layer
+    void CopyPixels(const Framebuffer& source) noexcept
+    {
+        if (source.GetWidth() != framebuffer_.GetWidth() || source.GetHeight() != framebuffer_.GetHeight())
+            return;
+
+        for (int y = clipTop_; y < clipBottom_; ++y)
+        {
+            const auto row = source.GetRow(y);
+            std::copy(row + clipLeft_, row + clipRight_, framebuffer_.GetRow(y) + clipLeft_);
+        }
+    }
+
+    // pen position is rounded to whole pixels per glyph, so glyph bitmaps are blended without resampling
+    void LayoutGlyphRun(LPCWSTR text, eFont font, const PointF& origin, GlyphRun& run) override final
+    {
+        const auto& data = GetFont(font);
+        run.Reset(text, font, origin);
+
+        const auto baseline = int(std::lround(origin.Y + data.ascent));
+        auto pen = origin.X;
+        float width = 0.f;
+
+        for (size_t i = 0; i < run.length; ++i)
+        {
+            const auto& glyph = data.GetGlyph(run.text[i]);
+            run.glyphs[i] = { run.text[i], int(std::lround(pen)) + glyph.left, baseline - glyph.top };
+            pen += glyph.advance / 64.f;
+            width += glyph.advance / 64.f;
+        }
+
+        run.glyphCount = run.length;
+        run.bounds = RectF(origin.X, origin.Y, width, data.lineHeight);
+    }
+
+    void DrawGlyphRun(const GlyphRun& run, const Color& color) override final
+    {
+        const auto& data = GetFont(run.font);
+        const auto value = color.GetValue();
+
+        for (size_t i = 0; i < run.glyphCount; ++i)
+        {
+            const auto& glyph = run.glyphs[i];
+            DrawGlyph(data, data.GetGlyph(glyph.ch), glyph.left, glyph.top, value);
+        }
+    }
+
+private:
+    // first pixel with center at or after coordinate
+    static int ToPixel(float coord) noexcept
+    {
+        return int(std::ceil(coord - 0.5f));
+    }
+
+    static const FontData& GetFont(eFont font) noexcept
+    {
+        return eFont::hint == font ? c_FontHint : c_FontText;
+    }
+
+    void FillSpan(uint32_t* row, int x0, int x1, uint32_t color) const noexcept
+    {
+        if (x0 >= x1)
+            return;
+
+        if (0xFF == (color >> 24))
+        {
+            fillSpan_(row + x0, size_t(x1 - x0), color);
+            return;
+        }
+
+        for (int x = x0; x < x1; ++x)
+            row[x] = BlendPixel(row[x], color, 255);
+    }
+
+    void DrawGlyph(const FontData& data, const GlyphInfo& glyph, int left, int top, uint32_t color) noexcept
+    {
+        const auto x0 = std::max(left, clipLeft_);
+        const auto x1 = std::min(left + int(glyph.width), clipRight_);
+        const auto y0 = std::max(top, clipTop_);
+        const auto y1 = std::min(top + int(glyph.height), clipBottom_);
+
+        for (int y = y0; y < y1; ++y)
+        {
+            const auto coverage = data.coverage + glyph.offset + size_t(y - top) * glyph.width;
+            auto row = framebuffer_.GetRow(y);
+            for (int x = x0; x < x1; ++x)
+            {
+                const auto value = coverage[x - left];
+                if (0 != value)
+                    row[x] = BlendPixel(row[x], color, value);
+            }
+        }
+    }
+
+    Framebuffer& framebuffer_;
+    TFillSpan fillSpan_;
+    int clipLeft_{};
+    int clipTop_{};
+    int clipRight_{};
+    int clipBottom_{};
+};
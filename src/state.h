@@ -0,0 +1,158 @@
+#pragma once
+
+// game state as plain bytes: elements write their fields in fixed order and read them back in same order
+// layout (bounds computed from world rect) is not part of state, it is computed again when needed
+// values are of fixed width only, so layout is same for 32 and 64 bit builds, bytes are little endian as on all targets of game
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// value types state is made of, size_t, bool, enums and structs are converted to them by elements
+template <typename T>
+constexpr bool c_IsStateValue = std::is_same<T, uint8_t>::value || std::is_same<T, uint16_t>::value || std::is_same<T, uint32_t>::value
+    || std::is_same<T, uint64_t>::value || std::is_same<T, float>::value;
+
+static_assert(sizeof(float) == 4 && std::numeric_limits<float>::is_iec559, "floats of state are IEEE 754 single precision");
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// appends to vector after offset bytes it keeps, vector keeps capacity, so writing state of same size again does not allocate
+class StateWriter
+{
+public:
+    explicit StateWriter(std::vector<uint8_t>& out, size_t offset = 0)
+        : out_(out)
+    {
+        out_.resize(offset);
+    }
+
+    template <typename T>
+    void Add(T value)
+    {
+        static_assert(c_IsStateValue<T>, "only fixed width values are written");
+        AddBytes(&value, sizeof(T));
+    }
+
+    void AddBytes(const void* data, size_t size)
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        out_.insert(out_.end(), bytes, bytes + size);
+    }
+
+private:
+    std::vector<uint8_t>& out_;
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// reads fail once data ends, then reader stays failed
+class StateReader
+{
+public:
+    StateReader(const uint8_t* data, size_t size) noexcept
+        : data_(data)
+        , size_(size)
+    {
+    }
+
+    template <typename T>
+    bool Get(T& value) noexcept
+    {
+        static_assert(c_IsStateValue<T>, "only fixed width values are read");
+        return GetBytes(&value, sizeof(T));
+    }
+
+    // value which has to be 0 or 1
+    bool GetBool(bool& value) noexcept
+    {
+        uint8_t byte = 0;
+        if (!Get(byte) || byte > 1)
+            return false;
+
+        value = 0 != byte;
+        return true;
+    }
+
+    // float which has to be finite
+    bool GetFinite(float& value) noexcept
+    {
+        return Get(value) && std::isfinite(value);
+    }
+
+    bool GetBytes(void* data, size_t size) noexcept
+    {
+        if (failed_ || size_ - pos_ < size)
+        {
+            failed_ = true;
+            return false;
+        }
+
+        std::memcpy(data, data_ + pos_, size);
+        pos_ += size;
+        return true;
+    }
+
+    // size bytes are skipped and returned in place, nullptr when data ends
+    const uint8_t* Take(size_t size) noexcept
+    {
+        if (failed_ || size_ - pos_ < size)
+        {
+            failed_ = true;
+            return nullptr;
+        }
+
+        const auto res = data_ + pos_;
+        pos_ += size;
+        return res;
+    }
+
+    bool IsFailed() const noexcept { return failed_; }
+    bool IsAtEnd() const noexcept { return pos_ == size_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_{};
+    bool failed_{};
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// FNV-1a of fixed width values added, as state is written, so hash is same on 32 and 64 bit builds of all targets
+class StateHash
+{
+public:
+    template <typename T>
+    void Add(T value) noexcept
+    {
+        static_assert(c_IsStateValue<T>, "only fixed width values are hashed");
+        AddBytes(&value, sizeof(T));
+    }
+
+    void Add(const RectF& rect) noexcept
+    {
+        Add(rect.X);
+        Add(rect.Y);
+        Add(rect.Width);
+        Add(rect.Height);
+    }
+
+    void Add(const PointF& point) noexcept
+    {
+        Add(point.X);
+        Add(point.Y);
+    }
+
+    uint64_t Get() const noexcept { return hash_; }
+
+private:
+    void AddBytes(const void* data, size_t size) noexcept
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i)
+            hash_ = (hash_ ^ bytes[i]) * 1099511628211ull;
+    }
+
+private:
+    uint64_t hash_ = 14695981039346656037ull;
+};
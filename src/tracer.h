@@ -0,0 +1,230 @@
+#pragma once
+
+// trace events of threads in Chrome trace-event format, open written file in Perfetto or chrome://tracing
+// each thread writes to its own ring, so tracing takes no lock, disabled tracing costs one relaxed atomic load
+// events are kept until they are overwritten, export writes events since Start
+// ring of thread is allocated by first event it traces while tracing is on, threads which never trace only keep their names
+
+#include <array>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+//-------------------------------------------------------------------------------------------------------------------------------
+class Tracer
+{
+public:
+    static constexpr size_t c_Events = size_t(1) << 17; // per thread, power of two
+
+    bool IsEnabled() const noexcept
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // events which come later are exported
+    void Start()
+    {
+        std::lock_guard<std::mutex> lock{ lock_ };
+        start_.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        for (auto& buffer : buffers_)
+        {
+            if (auto ring = buffer->ring.get())
+                ring->from.store(ring->next.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+        enabled_.store(true, std::memory_order_relaxed);
+    }
+
+    void Stop() noexcept
+    {
+        enabled_.store(false, std::memory_order_relaxed);
+    }
+
+    // name shown for calling thread, only pointer is kept, no ring is allocated for it
+    void SetThreadName(const char* name)
+    {
+        GetBuffer().name.store(name, std::memory_order_relaxed);
+    }
+
+    // name has to be string literal, only pointer is kept
+    void Begin(const char* name) noexcept { Add('B', name); }
+    void End(const char* name) noexcept { Add('E', name); }
+    void Instant(const char* name) noexcept { Add('i', name); }
+
+    // writes events since Start as JSON, false when file cannot be written
+    bool Write(const char* path)
+    {
+        std::lock_guard<std::mutex> lock{ lock_ };
+        const auto start = start_.load(std::memory_order_relaxed);
+
+        std::ofstream file(path);
+        file << "{\"traceEvents\":[\n";
+        bool first = true;
+        char line[192] = {};
+
+        for (size_t tid = 0; tid < buffers_.size(); ++tid)
+        {
+            const auto& buffer = *buffers_[tid];
+            const auto name = buffer.name.load(std::memory_order_relaxed);
+            std::snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"%s\"}}",
+                first ? "" : ",\n", tid + 1, name ? name : "thread");
+            file << line;
+            first = false;
+
+            if (!buffer.ring)
+                continue;
+
+            const auto& ring = *buffer.ring;
+            const auto next = ring.next.load(std::memory_order_acquire);
+            const auto from = std::max(ring.from.load(std::memory_order_relaxed), next > c_Events ? next - c_Events : 0);
+            for (size_t i = from; i < next; ++i)
+            {
+                const auto& event = ring.events[i & (c_Events - 1)];
+                const auto time = std::chrono::steady_clock::duration(event.time.load(std::memory_order_relaxed) - start);
+                const auto phase = event.phase.load(std::memory_order_relaxed);
+                std::snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu%s}",
+                    event.name.load(std::memory_order_relaxed), phase,
+                    std::chrono::duration<double, std::micro>(time).count(), tid + 1, 'i' == phase ? ",\"s\":\"t\"" : "");
+                file << line;
+            }
+        }
+
+        file << "\n]}\n";
+        file.close();
+        return !file.fail();
+    }
+
+private:
+    // atomics so that export while thread traces is no data race, event overwritten meanwhile may come out mixed
+    struct Event
+    {
+        std::atomic<int64_t> time{}; // clock ticks
+        std::atomic<const char*> name{};
+        std::atomic<char> phase{};
+    };
+
+    struct Ring
+    {
+        std::atomic<size_t> next{}; // only grows, written by own thread
+        std::atomic<size_t> from{}; // first event since Start
+        std::array<Event, c_Events> events;
+    };
+
+    // per thread, ring is set once under lock_ and read by export under lock_ too
+    struct Buffer
+    {
+        std::atomic<const char*> name{};
+        std::unique_ptr<Ring> ring;
+    };
+
+    // event of thread which has no ring yet is dropped when ring cannot be allocated
+    void Add(char phase, const char* name) noexcept
+    {
+        if (!IsEnabled())
+            return;
+
+        thread_local Ring* ring = nullptr;
+        if (nullptr == ring)
+        {
+            ring = AllocateRing();
+            if (nullptr == ring)
+                return;
+        }
+
+        const auto next = ring->next.load(std::memory_order_relaxed);
+        auto& event = ring->events[next & (c_Events - 1)];
+        event.time.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        event.name.store(name, std::memory_order_relaxed);
+        event.phase.store(phase, std::memory_order_relaxed);
+        ring->next.store(next + 1, std::memory_order_release);
+    }
+
+    Ring* AllocateRing() noexcept
+    {
+        try
+        {
+            auto& buffer = GetBuffer();
+            std::lock_guard<std::mutex> lock{ lock_ };
+            buffer.ring = std::make_unique<Ring>();
+            return buffer.ring.get();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    // buffer of calling thread, buffers are kept after their threads end, so their events can still be written
+    Buffer& GetBuffer()
+    {
+        static thread_local Buffer* buffer = nullptr;
+        if (nullptr == buffer)
+        {
+            std::lock_guard<std::mutex> lock{ lock_ };
+            buffers_.push_back(std::make_unique<Buffer>());
+            buffer = buffers_.back().get();
+        }
+        return *buffer;
+    }
+
+    std::atomic_bool enabled_{};
+    std::atomic<int64_t> start_{};
+    std::mutex lock_; // guards list of buffers and rings set in them
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+// one for process, thread rings are tied to it
+inline Tracer g_Tracer;
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// span of its scope, name has to be string literal
+class TraceScope
+{
+public:
+    explicit TraceScope(const char* name) noexcept
+        : name_(name)
+    {
+        g_Tracer.Begin(name_);
+    }
+
+    ~TraceScope()
+    {
+        g_Tracer.End(name_);
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+};
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// lock_guard which traces wait for mutex and time it is held as spans, names have to be string literals
+template <typename TMutex>
+class TraceLockGuard
+{
+public:
+    TraceLockGuard(TMutex& mutex, const char* waitName, const char* holdName)
+        : mutex_(mutex)
+        , holdName_(holdName)
+    {
+        g_Tracer.Begin(waitName);
+        mutex_.lock();
+        g_Tracer.End(waitName);
+        g_Tracer.Begin(holdName_);
+    }
+
+    ~TraceLockGuard()
+    {
+        g_Tracer.End(holdName_);
+        mutex_.unlock();
+    }
+
+    TraceLockGuard(const TraceLockGuard&) = delete;
+    TraceLockGuard& operator=(const TraceLockGuard&) = delete;
+
+private:
+    TMutex& mutex_;
+    const char* holdName_;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+
+//-------------------------------------------------------------------------------------------------------------------------------
+// lock-free triple buffer: one writer publishes values, one reader takes latest of them, neither of them waits
+// writer and reader own one slot each, third slot holds latest published value and is swapped with them
+// writer side (GetBack, Publish) and reader side (GetFront) must be used by one thread at a time each
+template <typename T>
+class TripleBuffer
+{
+public:
+    // slot to fill before Publish, keeps value written to it three publishes ago
+    T& GetBack() noexcept
+    {
+        return slots_[back_];
+    }
+
+    // makes back slot latest value
+    void Publish() noexcept
+    {
+        back_ = latest_.exchange(uint8_t(back_ | c_Fresh), std::memory_order_acq_rel) & c_IndexMask;
+    }
+
+    // latest published value, same as before if nothing was published since last call
+    const T& GetFront() noexcept
+    {
+        if (0 != (latest_.load(std::memory_order_relaxed) & c_Fresh))
+            front_ = latest_.exchange(front_, std::memory_order_acq_rel) & c_IndexMask;
+
+        return slots_[front_];
+    }
+
+private:
+    static constexpr uint8_t c_IndexMask = 0x3;
+    static constexpr uint8_t c_Fresh = 0x4; // latest slot was published and not taken by reader yet
+
+    std::array<T, 3> slots_;
+    std::atomic<uint8_t> latest_{ 1 };
+    uint8_t back_ = 0;
+    uint8_t front_ = 2;
+};
@@ -0,0 +1,328 @@
+#!/usr/bin/env python3
+# Rasterizes ASCII glyphs of a TrueType font into 8 bit coverage bitmaps and writes them as C++ header.
+# usage: makefont.py font.ttf out.h name:pixels [name:pixels ...]
+# example: makefont.py /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf ../src/fontdata.h Text:14 Hint:12
+
+import math
+import os
+import struct
+import sys
+
+FIRST_CHAR = 32
+LAST_CHAR = 126
+SUBSAMPLES = 16  # vertical samples per pixel, horizontal coverage is exact
+CURVE_STEPS = 8  # lines per quadratic segment
+
+
+class TrueTypeFont:
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        num_tables = struct.unpack_from('>H', self.data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from('>4sIII', self.data, 12 + i * 16)
+            self.tables[tag.decode('latin-1')] = (offset, length)
+
+        head = self.tables['head'][0]
+        self.units_per_em = struct.unpack_from('>H', self.data, head + 18)[0]
+        self.loca_long = struct.unpack_from('>h', self.data, head + 50)[0] == 1
+
+        hhea = self.tables['hhea'][0]
+        self.ascender, self.descender, self.line_gap = struct.unpack_from('>hhh', self.data, hhea + 4)
+        self.num_hmetrics = struct.unpack_from('>H', self.data, hhea + 34)[0]
+
+        self.num_glyphs = struct.unpack_from('>H', self.data, self.tables['maxp'][0] + 4)[0]
+        self.cmap = self._read_cmap()
+
+    def _read_cmap(self):
+        cmap = self.tables['cmap'][0]
+        count = struct.unpack_from('>H', self.data, cmap + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from('>HHI', self.data, cmap + 4 + i * 8)
+            sub = cmap + offset
+            if platform == 3 and encoding == 1 and struct.unpack_from('>H', self.data, sub)[0] == 4:
+                return self._read_cmap4(sub)
+        raise ValueError('no unicode cmap format 4')
+
+    def _read_cmap4(self, sub):
+        seg_count = struct.unpack_from('>H', self.data, sub + 6)[0] // 2
+        ends = sub + 14
+        starts = ends + seg_count * 2 + 2
+        deltas = starts + seg_count * 2
+        range_offsets = deltas + seg_count * 2
+
+        res = {}
+        for code in range(FIRST_CHAR, LAST_CHAR + 1):
+            for s in range(seg_count):
+                end = struct.unpack_from('>H', self.data, ends + s * 2)[0]
+                if code > end:
+                    continue
+                start = struct.unpack_from('>H', self.data, starts + s * 2)[0]
+                if code < start:
+                    break
+                delta = struct.unpack_from('>h', self.data, deltas + s * 2)[0]
+                range_offset = struct.unpack_from('>H', self.data, range_offsets + s * 2)[0]
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    address = range_offsets + s * 2 + range_offset + (code - start) * 2
+                    glyph = struct.unpack_from('>H', self.data, address)[0]
+                    if glyph != 0:
+                        glyph = (glyph + delta) & 0xFFFF
+                res[code] = glyph
+                break
+        return res
+
+    def advance(self, glyph):
+        hmtx = self.tables['hmtx'][0]
+        index = min(glyph, self.num_hmetrics - 1)
+        return struct.unpack_from('>H', self.data, hmtx + index * 4)[0]
+
+    def _glyph_offset(self, glyph):
+        loca = self.tables['loca'][0]
+        if self.loca_long:
+            start, end = struct.unpack_from('>II', self.data, loca + glyph * 4)
+        else:
+            start, end = (v * 2 for v in struct.unpack_from('>HH', self.data, loca + glyph * 2))
+        return start, end
+
+    # list of contours, contour is list of (x, y, on_curve)
+    def contours(self, glyph):
+        start, end = self._glyph_offset(glyph)
+        if start == end:
+            return []
+
+        offset = self.tables['glyf'][0] + start
+        num_contours = struct.unpack_from('>h', self.data, offset)[0]
+        if num_contours >= 0:
+            return self._simple_contours(offset, num_contours)
+        return self._composite_contours(offset)
+
+    def _simple_contours(self, offset, num_contours):
+        pos = offset + 10
+        end_points = struct.unpack_from('>%dH' % num_contours, self.data, pos)
+        pos += num_contours * 2
+        instructions = struct.unpack_from('>H', self.data, pos)[0]
+        pos += 2 + instructions
+
+        count = end_points[-1] + 1 if num_contours else 0
+        flags = []
+        while len(flags) < count:
+            flag = self.data[pos]
+            pos += 1
+            flags.append(flag)
+            if flag & 8:
+                repeat = self.data[pos]
+                pos += 1
+                flags.extend([flag] * repeat)
+
+        def read_coords(short_bit, same_bit):
+            nonlocal pos
+            values = []
+            value = 0
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self.data[pos]
+                    pos += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += struct.unpack_from('>h', self.data, pos)[0]
+                    pos += 2
+                values.append(value)
+            return values
+
+        xs = read_coords(2, 16)
+        ys = read_coords(4, 32)
+
+        res = []
+        first = 0
+        for last in end_points:
+            res.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(first, last + 1)])
+            first = last + 1
+        return res
+
+    def _composite_contours(self, offset):
+        pos = offset + 10
+        res = []
+        while True:
+            flags, glyph = struct.unpack_from('>HH', self.data, pos)
+            pos += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from('>hh', self.data, pos)
+                pos += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self.data, pos)
+                pos += 2
+
+            a, b, c, d = 1., 0., 0., 1.
+            if flags & 8:
+                a = d = struct.unpack_from('>h', self.data, pos)[0] / 16384.
+                pos += 2
+            elif flags & 0x40:
+                a, d = (v / 16384. for v in struct.unpack_from('>hh', self.data, pos))
+                pos += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384. for v in struct.unpack_from('>hhhh', self.data, pos))
+                pos += 8
+
+            if not flags & 2:
+                raise ValueError('point matched composites are not supported')
+
+            for contour in self.contours(glyph):
+                res.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+
+            if not flags & 0x20:
+                break
+        return res
+
+
+# contour with implied on curve points -> list of line segments ((x0, y0), (x1, y1))
+def flatten(contour):
+    points = []
+    count = len(contour)
+    for i in range(count):
+        x, y, on = contour[i]
+        points.append((x, y, on))
+        nx, ny, non = contour[(i + 1) % count]
+        if not on and not non:
+            points.append(((x + nx) / 2., (y + ny) / 2., True))
+
+    # start from on curve point
+    start = next(i for i, p in enumerate(points) if p[2])
+    points = points[start:] + points[:start]
+
+    lines = []
+    i = 0
+    count = len(points)
+    while i < count:
+        x0, y0, _ = points[i]
+        x1, y1, on1 = points[(i + 1) % count]
+        if on1:
+            lines.append(((x0, y0), (x1, y1)))
+            i += 1
+        else:
+            x2, y2, _ = points[(i + 2) % count]
+            prev = (x0, y0)
+            for step in range(1, CURVE_STEPS + 1):
+                t = step / CURVE_STEPS
+                u = 1. - t
+                p = (u * u * x0 + 2 * u * t * x1 + t * t * x2, u * u * y0 + 2 * u * t * y1 + t * t * y2)
+                lines.append((prev, p))
+                prev = p
+            i += 2
+    return lines
+
+
+# coverage of lines (pixel units, y down) in bitmap of width x height, nonzero winding
+def rasterize(lines, width, height):
+    coverage = [0.] * (width * height)
+    for row in range(height):
+        for sample in range(SUBSAMPLES):
+            y = row + (sample + 0.5) / SUBSAMPLES
+            crossings = []
+            for (x0, y0), (x1, y1) in lines:
+                if y0 == y1:
+                    continue
+                if min(y0, y1) <= y < max(y0, y1):
+                    x = x0 + (y - y0) * (x1 - x0) / (y1 - y0)
+                    crossings.append((x, 1 if y1 > y0 else -1))
+            crossings.sort()
+
+            winding = 0
+            for i, (x, direction) in enumerate(crossings):
+                previous = winding
+                winding += direction
+                if previous != 0 and i > 0:
+                    add_span(coverage, row * width, width, crossings[i - 1][0], x)
+    return [min(255, int(round(v / SUBSAMPLES * 255))) for v in coverage]
+
+
+def add_span(coverage, base, width, x0, x1):
+    x0 = max(x0, 0.)
+    x1 = min(x1, float(width))
+    col = int(math.floor(x0))
+    while col < width and col < x1:
+        overlap = min(x1, col + 1.) - max(x0, float(col))
+        if overlap > 0:
+            coverage[base + col] += overlap
+        col += 1
+
+
+def make_font(font, pixels):
+    scale = pixels / font.units_per_em
+    glyphs = []
+    data = []
+    for code in range(FIRST_CHAR, LAST_CHAR + 1):
+        glyph = font.cmap.get(code, 0)
+        advance = int(round(font.advance(glyph) * scale * 64))
+
+        lines = []
+        for contour in font.contours(glyph):
+            lines.extend(flatten(contour))
+
+        if not lines:
+            glyphs.append((len(data), 0, 0, 0, 0, advance, code))
+            continue
+
+        xs = [p[0] for line in lines for p in line]
+        ys = [p[1] for line in lines for p in line]
+        left = int(math.floor(min(xs) * scale))
+        top = int(math.ceil(max(ys) * scale))
+        width = int(math.ceil(max(xs) * scale)) - left
+        height = top - int(math.floor(min(ys) * scale))
+
+        # to bitmap pixels, y goes down from top
+        pixel_lines = [((x0 * scale - left, top - y0 * scale), (x1 * scale - left, top - y1 * scale))
+                       for (x0, y0), (x1, y1) in lines]
+
+        glyphs.append((len(data), width, height, left, top, advance, code))
+        data.extend(rasterize(pixel_lines, width, height))
+
+    ascent = font.ascender * scale
+    line_height = (font.ascender - font.descender + font.line_gap) * scale
+    return glyphs, data, ascent, line_height
+
+
+def main():
+    if len(sys.argv) < 4:
+        print(__doc__ or 'usage: makefont.py font.ttf out.h name:pixels [name:pixels ...]')
+        return 1
+
+    font = TrueTypeFont(sys.argv[1])
+    out = []
+    out.append('#pragma once')
+    out.append('')
+    out.append('// generated by tools/makefont.py from %s, do not edit' % os.path.basename(sys.argv[1]))
+    out.append('')
+
+    for spec in sys.argv[3:]:
+        name, pixels = spec.split(':')
+        glyphs, data, ascent, line_height = make_font(font, float(pixels))
+
+        out.append('inline constexpr GlyphInfo c_Font%sGlyphs[] = {' % name)
+        for offset, width, height, left, top, advance, code in glyphs:
+            char = chr(code)
+            comment = repr(char) if char not in '\\' else "'\\\\'"
+            out.append('    { %d, %d, %d, %d, %d, %d }, // %s' % (offset, width, height, left, top, advance, comment))
+        out.append('};')
+        out.append('')
+
+        out.append('inline constexpr uint8_t c_Font%sCoverage[] = {' % name)
+        for i in range(0, len(data), 24):
+            out.append('    ' + ','.join(str(v) for v in data[i:i + 24]) + ',')
+        out.append('};')
+        out.append('')
+
+        out.append('inline constexpr FontData c_Font%s{ %.1ff, %.4ff, %.4ff, %d, %d, c_Font%sGlyphs, c_Font%sCoverage };'
+                   % (name, float(pixels), ascent, line_height, FIRST_CHAR, LAST_CHAR - FIRST_CHAR + 1, name, name))
+        out.append('')
+
+    with open(sys.argv[2], 'w', newline='\r\n') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())